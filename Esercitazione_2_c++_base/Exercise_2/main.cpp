@@ -1,8 +1,10 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include "pipeline.hpp"
 
 using namespace std;
+using namespace EncryptionLibrary;
 
 /// \brief ImportText import the text for encryption
 /// \param inputFilePath: the input file path
@@ -38,6 +40,22 @@ int main(int argc, char** argv)
   }
   string password = argv[1];
 
+  // large files: encrypt (or decrypt) input into output through the pipelined stages
+  if (argc >= 4)
+  {
+    const bool decrypt = argc >= 5 && string(argv[4]) == "decrypt";
+
+    if (!PipelineCipher(argv[2], argv[3], password, decrypt))
+    {
+      cerr<< "Something goes wrong with the pipeline"<< endl;
+      return -1;
+    }
+    else
+      cout<< (decrypt ? "Decryption" : "Encryption")<< " successful: result in "<< argv[3]<< endl;
+
+    return 0;
+  }
+
   string inputFileName = "./text.txt", text;
   if (!ImportText(inputFileName, text))
   {
@@ -88,20 +106,13 @@ bool Encrypt(const string& text,
     if(password.size() > text.size())
         return false;
 
-    for(unsigned int i = 0; i < password.size(); i++){
-        if(password[i] < 65 || password[i] > 90)
-            return false;
-    }
+    if(!CheckPassword(password))
+        return false;
 
-    unsigned int cont = 0;
+    size_t cont = 0;
     encryptedText = text;
 
-    for(unsigned int i = 0; i < text.size(); i++){
-        if(text[i] != ' '){
-            encryptedText[i] = ((text[i] - 65) + (password[cont % password.size()] - 65))%26 + 65;
-            cont++;
-        }
-    }
+    EncryptBlock(text.data(), text.size(), password, cont, &encryptedText[0]);
 
     return true;
 }
@@ -110,18 +121,13 @@ bool Decrypt(const string& text,
              const string& password,
              string& decryptedText)
 {
-    unsigned int cont = 0;
+    if(!CheckPassword(password))
+        return false;
+
+    size_t cont = 0;
     decryptedText = text;
 
-    for(unsigned int i = 0; i < text.size(); i++){
-        if(text[i] != ' '){
-            decryptedText[i] = text[i] - password[cont % password.size()] + 65;
-            if(text[i] - password[cont % password.size()] < 0){
-                decryptedText[i] += 26;
-            }
-            cont++;
-        }
-    }
+    DecryptBlock(text.data(), text.size(), password, cont, &decryptedText[0]);
 
     return  true;
 }
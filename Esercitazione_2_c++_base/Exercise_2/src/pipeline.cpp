@@ -0,0 +1,149 @@
+#include "pipeline.hpp"
+#include "spscQueue.hpp"
+
+#include <fstream>
+
+namespace EncryptionLibrary {
+
+    /// \brief Block of text moving through the pipeline, the last block of the file has last = true
+    struct Block
+    {
+        string text;
+        bool last = false;
+    };
+
+    inline bool IsSkipped(const char& c)
+    {
+        return c == ' ' || c == '\n' || c == '\r';
+    }
+
+    bool CheckPassword(const string& password)
+    {
+        if(password.empty())
+            return false;
+
+        for(unsigned int i = 0; i < password.size(); i++){
+            if(password[i] < 65 || password[i] > 90)
+                return false;
+        }
+
+        return true;
+    }
+
+    void EncryptBlock(const char* text,
+                      const size_t& size,
+                      const string& password,
+                      size_t& cont,
+                      char* encryptedText)
+    {
+        for(size_t i = 0; i < size; i++){
+            if(!IsSkipped(text[i])){
+                encryptedText[i] = ((text[i] - 65) + (password[cont % password.size()] - 65))%26 + 65;
+                cont++;
+            }
+            else
+                encryptedText[i] = text[i];
+        }
+    }
+
+    void DecryptBlock(const char* text,
+                      const size_t& size,
+                      const string& password,
+                      size_t& cont,
+                      char* decryptedText)
+    {
+        for(size_t i = 0; i < size; i++){
+            if(!IsSkipped(text[i])){
+                const int shift = text[i] - password[cont % password.size()];
+                decryptedText[i] = shift < 0 ? shift + 65 + 26 : shift + 65;
+                cont++;
+            }
+            else
+                decryptedText[i] = text[i];
+        }
+    }
+
+    bool PipelineCipher(const string& inputFilePath,
+                        const string& outputFilePath,
+                        const string& password,
+                        const bool& decrypt,
+                        const size_t& blockSize,
+                        const size_t& queueCapacity)
+    {
+        if(!CheckPassword(password) || blockSize == 0 || queueCapacity == 0)
+            return false;
+
+        ifstream inputFile(inputFilePath, ios::binary);
+
+        if(!inputFile.is_open())
+            return false;
+
+        ofstream outputFile(outputFilePath, ios::binary);
+
+        if(!outputFile.is_open())
+            return false;
+
+        SpscQueue<Block> readQueue(queueCapacity);
+        SpscQueue<Block> writeQueue(queueCapacity);
+        bool writeSuccess = true;
+
+        thread reader([&]()
+        {
+            Block block;
+
+            do
+            {
+                block.text.resize(blockSize);
+                inputFile.read(&block.text[0], blockSize);
+                block.text.resize(inputFile.gcount());
+                block.last = !inputFile;
+
+                readQueue.Push(block);
+            }
+            while(!block.last);
+        });
+
+        thread writer([&]()
+        {
+            Block block;
+
+            do
+            {
+                writeQueue.Pop(block);
+
+                // keep draining on error, otherwise the upstream stages would block forever
+                if(writeSuccess && !outputFile.write(block.text.data(), block.text.size()))
+                    writeSuccess = false;
+            }
+            while(!block.last);
+        });
+
+        // the cipher worker runs on the calling thread: the key position depends on
+        // every letter before the block, so a single worker keeps the stream ordered
+        Block block;
+        size_t cont = 0;
+        bool last;
+
+        do
+        {
+            readQueue.Pop(block);
+
+            if(decrypt)
+                DecryptBlock(block.text.data(), block.text.size(), password, cont, &block.text[0]);
+            else
+                EncryptBlock(block.text.data(), block.text.size(), password, cont, &block.text[0]);
+
+            last = block.last;
+            writeQueue.Push(block);
+        }
+        while(!last);
+
+        reader.join();
+        writer.join();
+
+        outputFile.close();
+
+        return writeSuccess && !outputFile.fail() && !inputFile.bad();
+    }
+
+}
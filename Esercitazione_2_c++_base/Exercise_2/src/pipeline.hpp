@@ -0,0 +1,56 @@
+#ifndef __PIPELINE_H
+#define __PIPELINE_H
+
+#include <string>
+
+using namespace std;
+
+namespace EncryptionLibrary {
+
+  /// \brief CheckPassword test that the password is not empty and contains only uppercase letters
+  bool CheckPassword(const string& password);
+
+  /// \brief EncryptBlock encrypt a block of text, spaces and line terminators are preserved
+  /// \param text: the block to encrypt
+  /// \param size: the number of characters of the block
+  /// \param password: the password for encryption
+  /// \param cont: the number of letters already encrypted before the block, updated at the end
+  /// \param encryptedText: the resulting encrypted block, it can be the same buffer of text
+  void EncryptBlock(const char* text,
+                    const size_t& size,
+                    const string& password,
+                    size_t& cont,
+                    char* encryptedText);
+
+  /// \brief DecryptBlock decrypt a block of text, spaces and line terminators are preserved
+  /// \param text: the block to decrypt
+  /// \param size: the number of characters of the block
+  /// \param password: the password for decryption
+  /// \param cont: the number of letters already decrypted before the block, updated at the end
+  /// \param decryptedText: the resulting decrypted block, it can be the same buffer of text
+  void DecryptBlock(const char* text,
+                    const size_t& size,
+                    const string& password,
+                    size_t& cont,
+                    char* decryptedText);
+
+  /// \brief PipelineCipher encrypt or decrypt a whole file with three concurrent stages:
+  /// a reader, a cipher worker and a writer connected by bounded lock-free queues,
+  /// so disk reads and writes overlap with the cipher
+  /// \param inputFilePath: the input file path
+  /// \param outputFilePath: the output file path
+  /// \param password: the password for encryption/decryption
+  /// \param decrypt: true to decrypt, false to encrypt
+  /// \param blockSize: the number of characters moved through the pipeline at once
+  /// \param queueCapacity: the number of blocks each queue can hold
+  /// \return the result of the operation, true is success, false is error
+  bool PipelineCipher(const string& inputFilePath,
+                      const string& outputFilePath,
+                      const string& password,
+                      const bool& decrypt,
+                      const size_t& blockSize = 1 << 20,
+                      const size_t& queueCapacity = 8);
+
+}
+
+#endif // __PIPELINE_H
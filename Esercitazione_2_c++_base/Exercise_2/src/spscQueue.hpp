@@ -0,0 +1,72 @@
+#ifndef __SPSCQUEUE_H
+#define __SPSCQUEUE_H
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace EncryptionLibrary {
+
+  /// \brief Bounded lock-free queue between exactly one producer thread and one consumer thread
+  template<typename T>
+  class SpscQueue
+  {
+    vector<T> buffer;
+    alignas(64) atomic<size_t> head; ///< next slot to pop, written only by the consumer
+    alignas(64) atomic<size_t> tail; ///< next slot to push, written only by the producer
+
+    public:
+        /// \param capacity: the maximum number of elements stored at the same time
+        SpscQueue(const size_t& capacity) : buffer(capacity + 1), head(0), tail(0) {}
+
+        /// \brief TryPush move value into the queue
+        /// \return false if the queue is full, value is left untouched
+        bool TryPush(T& value)
+        {
+            const size_t t = tail.load(memory_order_relaxed);
+            const size_t next = (t + 1) % buffer.size();
+
+            if(next == head.load(memory_order_acquire))
+                return false;
+
+            buffer[t] = std::move(value);
+            tail.store(next, memory_order_release);
+
+            return true;
+        }
+
+        /// \brief TryPop move the oldest element of the queue into value
+        /// \return false if the queue is empty
+        bool TryPop(T& value)
+        {
+            const size_t h = head.load(memory_order_relaxed);
+
+            if(h == tail.load(memory_order_acquire))
+                return false;
+
+            value = std::move(buffer[h]);
+            head.store((h + 1) % buffer.size(), memory_order_release);
+
+            return true;
+        }
+
+        /// \brief Push wait until there is room in the queue, then push value
+        void Push(T& value)
+        {
+            while(!TryPush(value))
+                this_thread::yield();
+        }
+
+        /// \brief Pop wait until the queue is not empty, then pop into value
+        void Pop(T& value)
+        {
+            while(!TryPop(value))
+                this_thread::yield();
+        }
+  };
+
+}
+
+#endif // __SPSCQUEUE_H
@@ -0,0 +1,77 @@
+#ifndef __TEST_PIPELINE_H
+#define __TEST_PIPELINE_H
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include "pipeline.hpp"
+#include "spscQueue.hpp"
+
+using namespace testing;
+using namespace std;
+using namespace EncryptionLibrary;
+
+TEST(TestPipeline, TestSpscQueue)
+{
+  SpscQueue<int> queue(3);
+  long long sum = 0;
+
+  thread consumer([&]()
+  {
+    int value;
+    for(int i = 0; i < 10000; i++){
+      queue.Pop(value);
+      sum += value;
+    }
+  });
+
+  for(int i = 0; i < 10000; i++){
+    int value = i;
+    queue.Push(value);
+  }
+
+  consumer.join();
+
+  EXPECT_EQ(sum, 10000LL*9999/2);
+}
+
+TEST(TestPipeline, TestEncryptBlock)
+{
+  string text = "ALICE I LOVE U";
+  string encryptedText = text;
+  size_t cont = 0;
+
+  EncryptBlock(text.data(), 7, "GATTO", cont, &encryptedText[0]);
+  EncryptBlock(text.data() + 7, text.size() - 7, "GATTO", cont, &encryptedText[7]);
+
+  EXPECT_EQ(encryptedText, "GLBVS O LHOS A");
+  EXPECT_EQ(cont, 11u);
+}
+
+TEST(TestPipeline, TestPipelineCipher)
+{
+  ostringstream text;
+  for(unsigned int i = 0; i < 1000; i++)
+    text << "THIS IS A GENERIC TEXT TO BE ENCRYPTED\n";
+
+  ofstream("pipeline_input.txt") << text.str();
+
+  ASSERT_TRUE(PipelineCipher("pipeline_input.txt", "pipeline_encrypted.txt", "GATTO", false, 100, 2));
+  ASSERT_TRUE(PipelineCipher("pipeline_encrypted.txt", "pipeline_decrypted.txt", "GATTO", true, 77, 3));
+
+  ostringstream encrypted, decrypted;
+  encrypted << ifstream("pipeline_encrypted.txt").rdbuf();
+  decrypted << ifstream("pipeline_decrypted.txt").rdbuf();
+
+  string expected = text.str();
+  size_t cont = 0;
+  EncryptBlock(expected.data(), expected.size(), "GATTO", cont, &expected[0]);
+
+  EXPECT_EQ(encrypted.str(), expected);
+  EXPECT_EQ(decrypted.str(), text.str());
+
+  EXPECT_FALSE(PipelineCipher("missing.txt", "pipeline_output.txt", "GATTO", false));
+  EXPECT_FALSE(PipelineCipher("pipeline_input.txt", "pipeline_output.txt", "gatto", false));
+}
+
+#endif // __TEST_PIPELINE_H
@@ -0,0 +1,9 @@
+#include "test_pipeline.hpp"
+
+#include <gtest/gtest.h>
+
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
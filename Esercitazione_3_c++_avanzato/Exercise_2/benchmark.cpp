@@ -0,0 +1,205 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "Eigen/Eigen"
+#include "linearSystem.hpp"
+#include "fixedSolver.hpp"
+#include "batchSolver.hpp"
+#include "denseSolver.hpp"
+#include "adaptiveSolver.hpp"
+#include "mixedSolver.hpp"
+
+using namespace std;
+using namespace Eigen;
+using namespace LinearSystemLibrary;
+
+/// \brief Pool of test systems of the same size and condition number, all with solution [1, ..., 1]
+struct SystemsPool
+{
+  vector<MatrixXd> A;
+  vector<VectorXd> b;
+  VectorXd solution;
+};
+
+/// \brief Generate a random n x n matrix with 2-norm condition number close to condition:
+/// A = U S V' with U, V random orthogonal and singular values log-spaced in [1/condition, 1]
+MatrixXd RandomMatrix(const unsigned int& n,
+                      const double& condition);
+
+/// \brief Time solve on batch systems cycling through the pool and print one row of the report
+/// \param flopsPerSystem: the nominal floating point operations of one solve
+/// \param solve: the solver, called with the index of the system in the pool
+template<typename Solve>
+void Measure(const string& method,
+             const unsigned int& n,
+             const double& condition,
+             const unsigned int& batch,
+             const double& flopsPerSystem,
+             const SystemsPool& pool,
+             Solve solve);
+
+/// \brief Measure the fixed-size solvers on the pool, the matrices are converted before timing
+template<int N>
+void MeasureFixed(const double& condition,
+                  const unsigned int& batch,
+                  const SystemsPool& pool);
+
+/// \brief Measure the structure of arrays 2x2 solver on the pool
+void MeasureBatch2x2(const double& condition,
+                     const unsigned int& batch,
+                     const SystemsPool& pool);
+
+int main(int argc, char** argv)
+{
+  const unsigned int maxSize = argc > 1 ? stoul(argv[1]) : 4096;
+  const unsigned int maxBatch = argc > 2 ? stoul(argv[2]) : 10000;
+  const double maxWork = 1e9; // batch n^3 bound of each measure
+  const unsigned int poolSize = 64;
+
+  cout<< "n;condition;batch;method;seconds;systems/s;GFLOP/s;errRelMax"<< endl;
+
+  for(unsigned int n = 2; n <= maxSize; n *= 2)
+    for(double condition : {1e1, 1e6, 1e12})
+      for(unsigned int batch = 1; batch <= maxBatch; batch *= 100)
+      {
+        if(batch > 1 && double(batch)*n*n*n > maxWork)
+          break;
+
+        SystemsPool pool;
+        pool.solution = VectorXd::Ones(n);
+
+        for(unsigned int i = 0; i < min(batch, poolSize); i++)
+        {
+          pool.A.push_back(RandomMatrix(n, condition));
+          pool.b.push_back(pool.A.back()*pool.solution);
+        }
+
+        const double flopsLU = 2.0/3.0*n*n*n + 2.0*n*n;
+        const double flopsQR = 4.0/3.0*n*n*n + 4.0*n*n;
+
+        Measure("PALU", n, condition, batch, flopsLU, pool,
+                [&pool](const unsigned int& i) { return SolveSystemPALU(pool.A[i], pool.b[i]); });
+
+        Measure("QR", n, condition, batch, flopsQR, pool,
+                [&pool](const unsigned int& i) { return SolveSystemQR(pool.A[i], pool.b[i]); });
+
+        Measure("BlockedPALU", n, condition, batch, flopsLU, pool,
+                [&pool](const unsigned int& i) { return SolveSystemBlockedLU(pool.A[i], pool.b[i]); });
+
+        Measure("Adaptive", n, condition, batch, flopsLU, pool,
+                [&pool](const unsigned int& i) { AdaptiveSolverInfo info; return SolveSystemAdaptive(pool.A[i], pool.b[i], info); });
+
+        Measure("MixedPrecision", n, condition, batch, flopsLU, pool,
+                [&pool](const unsigned int& i) { MixedPrecisionInfo info; return SolveSystemMixedPrecision(pool.A[i], pool.b[i], info); });
+
+        if(n == 2)
+        {
+          MeasureFixed<2>(condition, batch, pool);
+          MeasureBatch2x2(condition, batch, pool);
+        }
+        else if(n == 4)
+          MeasureFixed<4>(condition, batch, pool);
+      }
+
+  return 0;
+}
+
+MatrixXd RandomMatrix(const unsigned int& n,
+                      const double& condition)
+{
+  const MatrixXd U = HouseholderQR<MatrixXd>(MatrixXd::Random(n, n)).householderQ();
+  const MatrixXd V = HouseholderQR<MatrixXd>(MatrixXd::Random(n, n)).householderQ();
+  VectorXd singularValues(n);
+
+  for(unsigned int i = 0; i < n; i++)
+    singularValues(i) = pow(condition, -double(i)/(n - 1));
+
+  return U*singularValues.asDiagonal()*V.transpose();
+}
+
+template<typename Solve>
+void Measure(const string& method,
+             const unsigned int& n,
+             const double& condition,
+             const unsigned int& batch,
+             const double& flopsPerSystem,
+             const SystemsPool& pool,
+             Solve solve)
+{
+  const unsigned int poolSize = pool.A.size();
+  double errRelMax = 0.0;
+
+  for(unsigned int i = 0; i < poolSize; i++)
+  {
+    const VectorXd x = solve(i);
+    const double errRel = x.size() == n ? (pool.solution - x).norm()/pool.solution.norm() : numeric_limits<double>::infinity();
+    errRelMax = max(errRelMax, errRel);
+  }
+
+  double checksum = 0.0;
+  const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+  for(unsigned int i = 0; i < batch; i++)
+    checksum += solve(i % poolSize)(0);
+
+  const double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+  // the checksum keeps the solves alive
+  if(checksum == 0.123456789)
+    cerr<< checksum<< endl;
+
+  cout<< scientific<< n<< ";"<< condition<< ";"<< batch<< ";"<< method<< ";"<< seconds<< ";"
+      << batch/seconds<< ";"<< batch*flopsPerSystem/seconds*1e-9<< ";"<< errRelMax<< endl;
+}
+
+template<int N>
+void MeasureFixed(const double& condition,
+                  const unsigned int& batch,
+                  const SystemsPool& pool)
+{
+  vector<Matrix<double, N, N>, aligned_allocator<Matrix<double, N, N>>> A(pool.A.begin(), pool.A.end());
+  vector<Matrix<double, N, 1>, aligned_allocator<Matrix<double, N, 1>>> b(pool.b.begin(), pool.b.end());
+
+  const double flopsLU = 2.0/3.0*N*N*N + 2.0*N*N;
+  const double flopsQR = 4.0/3.0*N*N*N + 4.0*N*N;
+
+  Measure("FixedPALU", N, condition, batch, flopsLU, pool,
+          [&A, &b](const unsigned int& i) { return VectorXd(SolveSystemPALU<N>(A[i], b[i])); });
+
+  Measure("FixedQR", N, condition, batch, flopsQR, pool,
+          [&A, &b](const unsigned int& i) { return VectorXd(SolveSystemQR<N>(A[i], b[i])); });
+}
+
+void MeasureBatch2x2(const double& condition,
+                     const unsigned int& batch,
+                     const SystemsPool& pool)
+{
+  SystemsBatch2x2 systems;
+
+  for(unsigned int i = 0; i < batch; i++)
+  {
+    const MatrixXd& A = pool.A[i % pool.A.size()];
+    const VectorXd& b = pool.b[i % pool.b.size()];
+    systems.A11.push_back(A(0, 0));
+    systems.A12.push_back(A(0, 1));
+    systems.A21.push_back(A(1, 0));
+    systems.A22.push_back(A(1, 1));
+    systems.B1.push_back(b(0));
+    systems.B2.push_back(b(1));
+  }
+
+  SolutionsBatch2x2 solutions;
+  const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+  SolveBatch2x2(systems, solutions);
+  const double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+  double errRelMax = 0.0;
+
+  for(unsigned int i = 0; i < batch; i++)
+    errRelMax = max(errRelMax, (pool.solution - Vector2d(solutions.X1[i], solutions.X2[i])).norm()/pool.solution.norm());
+
+  cout<< scientific<< 2<< ";"<< condition<< ";"<< batch<< ";"<< "Batch2x2"<< ";"<< seconds<< ";"
+      << batch/seconds<< ";"<< batch*(2.0/3.0*8 + 8)/seconds*1e-9<< ";"<< errRelMax<< endl;
+}
@@ -1,30 +1,103 @@
+#include <chrono>
 #include <iostream>
+#include <new>
+#include <stdexcept>
 #include "Eigen/Eigen"
+#include "linearSystem.hpp"
+#include "fixedSolver.hpp"
+#include "matrixIO.hpp"
+#include "denseSolver.hpp"
+#include "sparseSolver.hpp"
+#include "mixedSolver.hpp"
+#include "batchValidation.hpp"
+#include "leastSquares.hpp"
 
 using namespace std;
 using namespace Eigen;
+using namespace LinearSystemLibrary;
 
-/// \brief Test the real solution of system Ax = b
-/// \return the relative error for PALU solver
-/// \return the relative error for QR solver
-void TestSolution(const MatrixXd& A,
-                  const VectorXd& b,
-                  const VectorXd& solution,
-                  double& errRelPALU,
-                  double& errRelQR);
-
-/// \brief Solve linear system with PALU
-/// \return the solution
-VectorXd SolveSystemPALU(const MatrixXd& A,
-                         const VectorXd& b);
-
-/// \brief Solve linear system with PALU
-/// \return the solution
-VectorXd SolveSystemQR(const MatrixXd& A,
-                       const VectorXd& b);
-
-int main()
+/// \brief Solve the system stored in a matrix file with the blocked PALU, the mixed-precision solver,
+/// fullPivLu and colPivHouseholderQr, printing the time and the relative error of each solver.
+/// The right-hand side is b = A x with x = [1, ..., 1]
+/// \param inputFilePath: the matrix file, see ImportMatrix
+/// \param numThreads: the number of threads of the blocked PALU, 0 uses all the hardware threads
+/// \param blockSize: the panel size of the blocked PALU
+/// \return the exit code of the program
+int DenseMode(const string& inputFilePath,
+              const unsigned int& numThreads,
+              const unsigned int& blockSize);
+
+/// \brief Write a random n x n matrix in the binary format read by ImportMatrix
+/// \return the exit code of the program
+int GenerateMode(const unsigned int& n,
+                 const string& outputFilePath);
+
+/// \brief Solve the sparse system stored in a Matrix Market coordinate file without densifying it,
+/// printing time, iterations and relative error. The right-hand side is b = A x with x = [1, ..., 1]
+/// \param method: lu, ldlt, cg or bicgstab
+/// \param preconditioner: diagonal or incomplete, used by cg and bicgstab
+/// \return the exit code of the program
+int SparseMode(const string& inputFilePath,
+               const string& method,
+               const string& preconditioner);
+
+/// \brief Validate the collection of systems stored in a file (see ImportTestSystems) in parallel,
+/// printing the histogram of the relative errors of each method
+/// \param numThreads: the number of threads, 0 uses all the hardware threads
+/// \return the exit code of the program
+int ValidateMode(const string& inputFilePath,
+                 const unsigned int& numThreads);
+
+/// \brief Solve the least-squares problem of the tall-skinny matrix stored in a matrix file with TSQR
+/// and colPivHouseholderQr, printing time, residual and relative error of each solver.
+/// The right-hand side is b = A x with x = [1, ..., 1]
+/// \param numThreads: the number of threads of TSQR, 0 uses all the hardware threads
+/// \return the exit code of the program
+int LeastSquaresMode(const string& inputFilePath,
+                     const unsigned int& numThreads);
+
+/// \brief Seconds elapsed since start
+double ElapsedSeconds(const chrono::steady_clock::time_point& start);
+
+int main(int argc, char** argv)
 {
+  if (argc > 1)
+  {
+    const string mode = argv[1];
+
+    // stoul throws invalid_argument or out_of_range on a wrong number: the usage is printed instead.
+    // The readers bound their allocations by the file size, bad_alloc is left for inputs too large for this machine
+    try
+    {
+      if (mode == "dense" && argc > 2)
+        return DenseMode(argv[2], argc > 3 ? stoul(argv[3]) : 0, argc > 4 ? stoul(argv[4]) : 128);
+
+      if (mode == "sparse" && argc > 2)
+        return SparseMode(argv[2], argc > 3 ? argv[3] : "lu", argc > 4 ? argv[4] : "diagonal");
+
+      if (mode == "lstsq" && argc > 2)
+        return LeastSquaresMode(argv[2], argc > 3 ? stoul(argv[3]) : 0);
+
+      if (mode == "validate" && argc > 2)
+        return ValidateMode(argv[2], argc > 3 ? stoul(argv[3]) : 0);
+
+      if (mode == "generate" && argc > 3)
+        return GenerateMode(stoul(argv[2]), argv[3]);
+    }
+    catch(const logic_error&)
+    {
+      cerr<< "Wrong number in the arguments"<< endl;
+    }
+    catch(const bad_alloc&)
+    {
+      cerr<< "Not enough memory for the input"<< endl;
+      return -1;
+    }
+
+    cerr<< "Usage: "<< argv[0]<< " [dense MATRIX_FILE [THREADS [BLOCK_SIZE]] | sparse MTX_FILE [lu|ldlt|cg|bicgstab [diagonal|incomplete]] | lstsq MATRIX_FILE [THREADS] | validate SYSTEMS_FILE [THREADS] | generate N MATRIX_FILE]"<< endl;
+    return -1;
+  }
+
   Vector2d solution(-1.0000e+0, -1.0000e+00);
 
   Matrix2d A1 = Matrix2d::Zero();
@@ -79,24 +152,184 @@ int main()
   return 0;
 }
 
-void TestSolution(const MatrixXd& A,
-                  const VectorXd& b,
-                  const VectorXd& solution,
-                  double& errRelPALU,
-                  double& errRelQR)
+double ElapsedSeconds(const chrono::steady_clock::time_point& start)
 {
-    errRelPALU = (solution - SolveSystemPALU(A, b)).norm()/solution.norm();
-    errRelQR = (solution - SolveSystemQR(A, b)).norm()/solution.norm();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
 }
 
-VectorXd SolveSystemPALU(const MatrixXd& A,
-                         const VectorXd& b)
+int DenseMode(const string& inputFilePath,
+              const unsigned int& numThreads,
+              const unsigned int& blockSize)
 {
-    return A.fullPivLu().solve(b);
+    MatrixXd A;
+
+    if(!ImportMatrix(inputFilePath, A) || A.rows() != A.cols() || A.rows() == 0)
+    {
+        cerr<< "Something goes wrong with import of "<< inputFilePath<< endl;
+        return -1;
+    }
+
+    const VectorXd solution = VectorXd::Ones(A.rows());
+    const VectorXd b = A*solution;
+
+    cout<< "n = "<< A.rows()<< endl;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    const VectorXd xBlocked = SolveSystemBlockedLU(A, b, blockSize, numThreads);
+    const double timeBlocked = ElapsedSeconds(start);
+
+    if(xBlocked.size() == 0)
+    {
+        cerr<< "The matrix is singular"<< endl;
+        return -1;
+    }
+
+    cout<< scientific<< "Blocked PALU: time "<< timeBlocked<< " s, error "
+        << (solution - xBlocked).norm()/solution.norm()<< endl;
+
+    MixedPrecisionInfo mixedInfo;
+    start = chrono::steady_clock::now();
+    const VectorXd xMixed = SolveSystemMixedPrecision(A, b, mixedInfo);
+    const double timeMixed = ElapsedSeconds(start);
+
+    cout<< "Mixed precision: time "<< timeMixed<< " s, error "<< (solution - xMixed).norm()/solution.norm()
+        << ", iterations "<< mixedInfo.Iterations<< (mixedInfo.Converged ? "" : " (not converged, double precision fallback)")<< endl;
+
+    start = chrono::steady_clock::now();
+    const VectorXd xPALU = SolveSystemPALU(A, b);
+    const double timePALU = ElapsedSeconds(start);
+
+    cout<< "fullPivLu: time "<< timePALU<< " s, error "<< (solution - xPALU).norm()/solution.norm()<< endl;
+
+    start = chrono::steady_clock::now();
+    const VectorXd xQR = SolveSystemQR(A, b);
+    const double timeQR = ElapsedSeconds(start);
+
+    cout<< "colPivHouseholderQr: time "<< timeQR<< " s, error "<< (solution - xQR).norm()/solution.norm()<< endl;
+
+    return 0;
 }
 
-VectorXd SolveSystemQR(const MatrixXd& A,
-                       const VectorXd& b)
+int SparseMode(const string& inputFilePath,
+               const string& method,
+               const string& preconditioner)
 {
-    return A.colPivHouseholderQr().solve(b);
+    SparseMethod sparseMethod;
+
+    if(method == "lu")
+        sparseMethod = SparseMethod::LU;
+    else if(method == "ldlt")
+        sparseMethod = SparseMethod::LDLT;
+    else if(method == "cg")
+        sparseMethod = SparseMethod::CG;
+    else if(method == "bicgstab")
+        sparseMethod = SparseMethod::BiCGSTAB;
+    else
+    {
+        cerr<< "Unknown sparse method "<< method<< endl;
+        return -1;
+    }
+
+    unsigned int rows, cols;
+    vector<Triplet<double>> entries;
+
+    if(!ImportMatrixMarketEntries(inputFilePath, rows, cols, entries) || rows != cols || rows == 0)
+    {
+        cerr<< "Something goes wrong with import of "<< inputFilePath<< endl;
+        return -1;
+    }
+
+    const CsrMatrix A = CsrFromTriplets(rows, cols, entries);
+    entries.clear();
+
+    const VectorXd solution = VectorXd::Ones(rows);
+    const VectorXd b = MapCsr(A)*solution;
+
+    cout<< "n = "<< rows<< ", non-zeros = "<< A.Values.size()<< endl;
+
+    SparseSolverInfo info;
+    const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    const VectorXd x = SolveSystemSparse(A, b, sparseMethod, info,
+                                         preconditioner == "incomplete" ? SparsePreconditioner::Incomplete : SparsePreconditioner::Diagonal);
+    const double time = ElapsedSeconds(start);
+
+    if(!info.Success)
+    {
+        cerr<< "The sparse solver "<< method<< " failed"<< endl;
+        return -1;
+    }
+
+    cout<< scientific<< method<< ": time "<< time<< " s, iterations "<< info.Iterations
+        << ", error "<< (solution - x).norm()/solution.norm()<< endl;
+
+    return 0;
+}
+
+int ValidateMode(const string& inputFilePath,
+                 const unsigned int& numThreads)
+{
+    vector<TestSystem> systems;
+
+    if(!ImportTestSystems(inputFilePath, systems))
+    {
+        cerr<< "Something goes wrong with import of "<< inputFilePath<< endl;
+        return -1;
+    }
+
+    VectorXd errRelPALU, errRelQR;
+    const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    TestSolutions(systems, errRelPALU, errRelQR, numThreads);
+    const double time = ElapsedSeconds(start);
+
+    cout<< systems.size()<< " systems validated in "<< time<< " s"<< endl;
+    cout<< "PALU relative errors:"<< endl<< BuildErrorHistogram(errRelPALU);
+    cout<< "QR relative errors:"<< endl<< BuildErrorHistogram(errRelQR);
+
+    return 0;
+}
+
+int LeastSquaresMode(const string& inputFilePath,
+                     const unsigned int& numThreads)
+{
+    MatrixXd A;
+
+    if(!ImportMatrix(inputFilePath, A) || A.rows() < A.cols() || A.cols() == 0)
+    {
+        cerr<< "Something goes wrong with import of "<< inputFilePath<< endl;
+        return -1;
+    }
+
+    const VectorXd solution = VectorXd::Ones(A.cols());
+    const VectorXd b = A*solution;
+
+    cout<< "m = "<< A.rows()<< ", n = "<< A.cols()<< endl;
+
+    double residualNorm;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    const VectorXd xTSQR = SolveLeastSquaresTSQR(A, b, residualNorm, numThreads);
+    const double timeTSQR = ElapsedSeconds(start);
+
+    cout<< scientific<< "TSQR: time "<< timeTSQR<< " s, residual "<< residualNorm
+        << ", error "<< (solution - xTSQR).norm()/solution.norm()<< endl;
+
+    start = chrono::steady_clock::now();
+    const VectorXd xQR = A.colPivHouseholderQr().solve(b);
+    const double timeQR = ElapsedSeconds(start);
+
+    cout<< "colPivHouseholderQr: time "<< timeQR<< " s, residual "<< (A*xQR - b).norm()
+        << ", error "<< (solution - xQR).norm()/solution.norm()<< endl;
+
+    return 0;
+}
+
+int GenerateMode(const unsigned int& n,
+                 const string& outputFilePath)
+{
+    if(!ExportMatrix(outputFilePath, MatrixXd::Random(n, n)))
+    {
+        cerr<< "Something goes wrong with export of "<< outputFilePath<< endl;
+        return -1;
+    }
+
+    return 0;
 }
@@ -0,0 +1,92 @@
+#include "adaptiveSolver.hpp"
+#include "batchSolver.hpp"
+#include "fixedSolver.hpp"
+
+#include <limits>
+
+namespace LinearSystemLibrary {
+
+    /// \brief Improve x with residual corrections while they keep shrinking
+    /// \return the number of corrections applied
+    template<typename Matrix, typename Vector, typename Solve>
+    unsigned int RefineSolution(const Matrix& A,
+                                const Vector& b,
+                                Vector& x,
+                                const unsigned int& maxSteps,
+                                Solve solve)
+    {
+        double previousCorrection = numeric_limits<double>::infinity();
+        unsigned int steps = 0;
+
+        while(steps < maxSteps)
+        {
+            const Vector correction = solve(Vector(b - A*x));
+            const double correctionNorm = correction.norm();
+
+            if(!(correctionNorm < previousCorrection))
+                break;
+
+            x += correction;
+            steps++;
+
+            if(correctionNorm <= numeric_limits<double>::epsilon()*x.norm())
+                break;
+
+            previousCorrection = correctionNorm;
+        }
+
+        return steps;
+    }
+
+    VectorXd SolveSystemAdaptive(const MatrixXd& A,
+                                 const VectorXd& b,
+                                 AdaptiveSolverInfo& info,
+                                 const double& rcondThreshold,
+                                 const unsigned int& maxRefinementSteps)
+    {
+        info = AdaptiveSolverInfo();
+
+        const PartialPivLU<MatrixXd> partialLU(A);
+        info.ReciprocalCondition = partialLU.rcond();
+
+        if(info.ReciprocalCondition >= rcondThreshold)
+            return partialLU.solve(b);
+
+        info.Method = AdaptiveMethod::FullPivLU;
+
+        const FullPivLU<MatrixXd> fullLU(A);
+        VectorXd x = fullLU.solve(b);
+
+        info.RefinementSteps = RefineSolution(A, b, x, maxRefinementSteps,
+                                              [&fullLU](const VectorXd& r) { return VectorXd(fullLU.solve(r)); });
+
+        return x;
+    }
+
+    Vector2d SolveSystemAdaptive(const Matrix2d& A,
+                                 const Vector2d& b,
+                                 AdaptiveSolverInfo& info,
+                                 const double& rcondThreshold,
+                                 const unsigned int& maxRefinementSteps)
+    {
+        info = AdaptiveSolverInfo();
+
+        Vector2d x;
+        double condition;
+
+        SolveBatch2x2(&A(0, 0), &A(0, 1), &A(1, 0), &A(1, 1), &b(0), &b(1), 1, &x(0), &x(1), &condition);
+        info.ReciprocalCondition = 1.0/condition;
+
+        if(info.ReciprocalCondition >= rcondThreshold)
+            return x;
+
+        info.Method = AdaptiveMethod::FullPivLU;
+        x = SolveSystemPALU<2>(A, b);
+
+        info.RefinementSteps = RefineSolution(A, b, x, maxRefinementSteps,
+                                              [&A](const Vector2d& r) { return SolveSystemPALU<2>(A, r); });
+
+        return x;
+    }
+
+}
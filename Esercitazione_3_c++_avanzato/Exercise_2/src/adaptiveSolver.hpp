@@ -0,0 +1,47 @@
+#ifndef __ADAPTIVESOLVER_H
+#define __ADAPTIVESOLVER_H
+
+#include "Eigen/Eigen"
+
+using namespace std;
+using namespace Eigen;
+
+namespace LinearSystemLibrary {
+
+  enum class AdaptiveMethod
+  {
+    PartialPivLU, ///< well-conditioned system, partial pivoting only
+    FullPivLU     ///< ill-conditioned system, full pivoting and iterative refinement
+  };
+
+  /// \brief Choice made by the adaptive solver
+  struct AdaptiveSolverInfo
+  {
+    AdaptiveMethod Method = AdaptiveMethod::PartialPivLU;
+    double ReciprocalCondition = 0.0; ///< estimate of 1/cond_1(A)
+    unsigned int RefinementSteps = 0;
+  };
+
+  /// \brief Solve linear system choosing the method from a cheap estimate of the conditioning:
+  /// the partial pivoting LU and its O(n^2) reciprocal condition estimate are always computed,
+  /// the full pivoting LU with iterative refinement only when the estimate is below rcondThreshold
+  /// \param info: the resulting choice of the solver
+  /// \return the solution
+  VectorXd SolveSystemAdaptive(const MatrixXd& A,
+                               const VectorXd& b,
+                               AdaptiveSolverInfo& info,
+                               const double& rcondThreshold = 1e-8,
+                               const unsigned int& maxRefinementSteps = 3);
+
+  /// \brief Solve 2x2 linear system choosing the method from the closed-form condition number,
+  /// see SolveSystemAdaptive
+  /// \return the solution
+  Vector2d SolveSystemAdaptive(const Matrix2d& A,
+                               const Vector2d& b,
+                               AdaptiveSolverInfo& info,
+                               const double& rcondThreshold = 1e-8,
+                               const unsigned int& maxRefinementSteps = 3);
+
+}
+
+#endif // __ADAPTIVESOLVER_H
@@ -0,0 +1,78 @@
+#include "batchSolver.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace LinearSystemLibrary {
+
+    bool SolveBatch2x2(const SystemsBatch2x2& systems,
+                       SolutionsBatch2x2& solutions)
+    {
+        const size_t numSystems = systems.A11.size();
+
+        if(systems.A12.size() != numSystems || systems.A21.size() != numSystems ||
+           systems.A22.size() != numSystems || systems.B1.size() != numSystems ||
+           systems.B2.size() != numSystems)
+            return false;
+
+        solutions.X1.resize(numSystems);
+        solutions.X2.resize(numSystems);
+        solutions.Condition.resize(numSystems);
+
+        SolveBatch2x2(systems.A11.data(), systems.A12.data(), systems.A21.data(), systems.A22.data(),
+                      systems.B1.data(), systems.B2.data(), numSystems,
+                      solutions.X1.data(), solutions.X2.data(), solutions.Condition.data());
+
+        return true;
+    }
+
+    void SolveBatch2x2(const double* __restrict a11,
+                       const double* __restrict a12,
+                       const double* __restrict a21,
+                       const double* __restrict a22,
+                       const double* __restrict b1,
+                       const double* __restrict b2,
+                       const size_t& numSystems,
+                       double* __restrict x1,
+                       double* __restrict x2,
+                       double* __restrict condition)
+    {
+        const double infinity = numeric_limits<double>::infinity();
+        const size_t n = numSystems;
+
+        // every coefficient is loaded once and every choice is a select between two computed values,
+        // so that the loop has no control flow and is vectorised (see -fno-trapping-math in CMakeLists.txt)
+        for(size_t i = 0; i < n; i++)
+        {
+            const double c11 = a11[i], c12 = a12[i], c21 = a21[i], c22 = a22[i];
+            const double d1 = b1[i], d2 = b2[i];
+
+            // pivoting as a blend: swap the rows when |a21| > |a11|
+            const bool swapRows = fabs(c21) > fabs(c11);
+
+            const double p11 = swapRows ? c21 : c11;
+            const double p12 = swapRows ? c22 : c12;
+            const double p21 = swapRows ? c11 : c21;
+            const double p22 = swapRows ? c12 : c22;
+            const double q1 = swapRows ? d2 : d1;
+            const double q2 = swapRows ? d1 : d2;
+
+            const double l = p21/p11;
+            const double u22 = p22 - l*p12;
+            const double y2 = (q2 - l*q1)/u22;
+
+            x2[i] = y2;
+            x1[i] = (q1 - p12*y2)/p11;
+
+            // cond_1(A) = ||A||_1 ||A^-1||_1 with A^-1 = adj(A)/det(A), the ratio is computed also for singular systems and discarded
+            const double det = fabs(p11*u22);
+            const double normA = max(fabs(c11) + fabs(c21), fabs(c12) + fabs(c22));
+            const double normAdj = max(fabs(c22) + fabs(c21), fabs(c12) + fabs(c11));
+            const double ratio = normA*normAdj/det;
+
+            condition[i] = det > 0.0 ? ratio : infinity;
+        }
+    }
+
+}
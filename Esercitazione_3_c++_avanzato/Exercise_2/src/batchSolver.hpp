@@ -0,0 +1,56 @@
+#ifndef __BATCHSOLVER_H
+#define __BATCHSOLVER_H
+
+#include <vector>
+
+using namespace std;
+
+namespace LinearSystemLibrary {
+
+  /// \brief Batch of independent 2x2 systems Ax = b stored as structure of arrays,
+  /// the i-th system is [A11[i], A12[i]; A21[i], A22[i]] x = [B1[i]; B2[i]]
+  struct SystemsBatch2x2
+  {
+    vector<double> A11;
+    vector<double> A12;
+    vector<double> A21;
+    vector<double> A22;
+    vector<double> B1;
+    vector<double> B2;
+  };
+
+  /// \brief Solutions of a SystemsBatch2x2, Condition is the 1-norm condition number of each A
+  struct SolutionsBatch2x2
+  {
+    vector<double> X1;
+    vector<double> X2;
+    vector<double> Condition;
+  };
+
+  /// \brief Solve every system of the batch with PALU (partial pivoting).
+  /// The loop is branch-free: the pivot row is chosen with selects instead of jumps and the arrays do not alias,
+  /// so the compiler maps consecutive systems to SIMD lanes (GCC and Clang with -O3 and -fno-trapping-math).
+  /// Singular systems give non-finite solutions and infinite condition number
+  /// \param systems: the batch of systems
+  /// \param solutions: the resulting solutions, resized to the batch size
+  /// \return the result of the operation, false if the arrays of the batch have different sizes
+  bool SolveBatch2x2(const SystemsBatch2x2& systems,
+                     SolutionsBatch2x2& solutions);
+
+  /// \brief Solve the 2x2 systems stored in raw arrays, see SolveBatch2x2
+  /// \param numSystems: the number of systems, every array has this size
+  /// \note the arrays must not overlap
+  void SolveBatch2x2(const double* __restrict a11,
+                     const double* __restrict a12,
+                     const double* __restrict a21,
+                     const double* __restrict a22,
+                     const double* __restrict b1,
+                     const double* __restrict b2,
+                     const size_t& numSystems,
+                     double* __restrict x1,
+                     double* __restrict x2,
+                     double* __restrict condition);
+
+}
+
+#endif // __BATCHSOLVER_H
@@ -0,0 +1,167 @@
+#include "batchValidation.hpp"
+#include "linearSystem.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <thread>
+
+namespace LinearSystemLibrary {
+
+    bool ImportTestSystems(const string& filePath,
+                           vector<TestSystem>& systems)
+    {
+        ifstream file(filePath);
+
+        if(file.fail())
+            return false;
+
+        file.seekg(0, ios::end);
+        const streampos fileEnd = file.tellg();
+        file.seekg(0, ios::beg);
+
+        systems.clear();
+        unsigned int n;
+
+        while(file >> n)
+        {
+            // the n*n + 2n values take at least two bytes each ("v\n"): a corrupt size must not allocate gigabytes
+            const streampos position = file.tellg();
+            const size_t remainingBytes = position == streampos(-1) ? 0 : static_cast<size_t>(fileEnd - position);
+
+            if(static_cast<size_t>(n)*(static_cast<size_t>(n) + 2) > (remainingBytes + 1)/2)
+                return false;
+
+            TestSystem system;
+            system.A.resize(n, n);
+            system.b.resize(n);
+            system.Solution.resize(n);
+
+            for(unsigned int i = 0; i < n; i++)
+                for(unsigned int j = 0; j < n; j++)
+                    file >> system.A(i, j);
+
+            for(unsigned int i = 0; i < n; i++)
+                file >> system.b(i);
+
+            for(unsigned int i = 0; i < n; i++)
+                file >> system.Solution(i);
+
+            if(file.fail())
+                return false;
+
+            systems.push_back(system);
+        }
+
+        return file.eof();
+    }
+
+    bool ExportTestSystems(const string& filePath,
+                           const vector<TestSystem>& systems)
+    {
+        ofstream file(filePath);
+
+        if(file.fail())
+            return false;
+
+        file.precision(17);
+
+        for(const TestSystem& system : systems)
+        {
+            file << system.A.rows() << "\n";
+
+            for(unsigned int i = 0; i < system.A.rows(); i++)
+            {
+                for(unsigned int j = 0; j < system.A.cols(); j++)
+                    file << system.A(i, j) << " ";
+
+                file << "\n";
+            }
+
+            file << system.b.transpose() << "\n" << system.Solution.transpose() << "\n";
+        }
+
+        return static_cast<bool>(file);
+    }
+
+    void TestSolutions(const vector<TestSystem>& systems,
+                       VectorXd& errRelPALU,
+                       VectorXd& errRelQR,
+                       const unsigned int& numThreads)
+    {
+        errRelPALU.resize(systems.size());
+        errRelQR.resize(systems.size());
+
+        const unsigned int threads = numThreads == 0 ? max(1u, thread::hardware_concurrency()) : numThreads;
+        atomic<size_t> next(0);
+
+        auto worker = [&]()
+        {
+            for(size_t s = next++; s < systems.size(); s = next++)
+                TestSolution(systems[s].A, systems[s].b, systems[s].Solution, errRelPALU(s), errRelQR(s));
+        };
+
+        vector<thread> workers;
+
+        for(unsigned int t = 1; t < threads; t++)
+            workers.push_back(thread(worker));
+
+        worker();
+
+        for(thread& w : workers)
+            w.join();
+    }
+
+    ErrorHistogram BuildErrorHistogram(const VectorXd& errors)
+    {
+        ErrorHistogram histogram;
+        const int numBuckets = histogram.Counts.size();
+
+        // errors from the last decade on, +inf included, never reach the conversion of the exponent to int
+        const double lastBucket = pow(10.0, histogram.MinExponent + numBuckets - 1);
+
+        for(unsigned int e = 0; e < errors.size(); e++)
+        {
+            if(std::isnan(errors(e))){
+                histogram.NotANumber++;
+                continue;
+            }
+
+            if(errors(e) >= lastBucket){
+                histogram.Counts[numBuckets - 1]++;
+                continue;
+            }
+
+            const int exponent = errors(e) > 0.0 ? floor(log10(errors(e))) : histogram.MinExponent;
+            const int bucket = min(max(exponent - histogram.MinExponent, 0), numBuckets - 1);
+
+            histogram.Counts[bucket]++;
+        }
+
+        return histogram;
+    }
+
+    ostream& operator<<(ostream& os, const ErrorHistogram& histogram)
+    {
+        const int numBuckets = histogram.Counts.size();
+
+        for(int k = 0; k < numBuckets; k++)
+        {
+            const int exponent = histogram.MinExponent + k;
+
+            if(k == 0)
+                os << "[0, 1e" << exponent + 1 << ")";
+            else if(k == numBuckets - 1)
+                os << "[1e" << exponent << ", inf]";
+            else
+                os << "[1e" << exponent << ", 1e" << exponent + 1 << ")";
+
+            os << "\t" << histogram.Counts[k] << endl;
+        }
+
+        os << "NaN\t" << histogram.NotANumber << endl;
+
+        return os;
+    }
+
+}
@@ -0,0 +1,63 @@
+#ifndef __BATCHVALIDATION_H
+#define __BATCHVALIDATION_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Eigen/Eigen"
+
+using namespace std;
+using namespace Eigen;
+
+namespace LinearSystemLibrary {
+
+  /// \brief System Ax = b with its real solution
+  struct TestSystem
+  {
+    MatrixXd A;
+    VectorXd b;
+    VectorXd Solution;
+  };
+
+  /// \brief Histogram of relative errors by decade: Counts[k] is the number of errors
+  /// in [10^(MinExponent + k), 10^(MinExponent + k + 1)), the first bucket also holds
+  /// smaller errors (zero included), the last one larger errors; NaN are counted apart
+  struct ErrorHistogram
+  {
+    int MinExponent = -17;
+    vector<unsigned int> Counts = vector<unsigned int>(18, 0);
+    unsigned int NotANumber = 0;
+  };
+
+  /// \brief Import test systems from a text file: every system is written as n followed by
+  /// the n x n entries of A by rows, the n entries of b and the n entries of the solution
+  /// \param filePath: the input file path
+  /// \param systems: the resulting systems
+  /// \return the result of the reading, true if is success, false otherwise
+  bool ImportTestSystems(const string& filePath,
+                         vector<TestSystem>& systems);
+
+  /// \brief Export test systems in the format read by ImportTestSystems
+  /// \return the result of the writing, true if is success, false otherwise
+  bool ExportTestSystems(const string& filePath,
+                         const vector<TestSystem>& systems);
+
+  /// \brief Run TestSolution on every system, the systems are shared among the threads
+  /// one at a time, so batches of mixed sizes stay balanced
+  /// \param numThreads: the number of threads, 0 uses all the hardware threads
+  /// \return the relative errors for PALU solver, one per system
+  /// \return the relative errors for QR solver, one per system
+  void TestSolutions(const vector<TestSystem>& systems,
+                     VectorXd& errRelPALU,
+                     VectorXd& errRelQR,
+                     const unsigned int& numThreads = 0);
+
+  /// \brief Build the histogram by decade of the relative errors
+  ErrorHistogram BuildErrorHistogram(const VectorXd& errors);
+
+  /// \brief Print the histogram, one line per decade
+  ostream& operator<<(ostream& os, const ErrorHistogram& histogram);
+
+}
+
+#endif // __BATCHVALIDATION_H
@@ -0,0 +1,120 @@
+#include "denseSolver.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace LinearSystemLibrary {
+
+    bool BlockedLU(MatrixXd& A,
+                   VectorXi& pivots,
+                   const unsigned int& blockSize,
+                   const unsigned int& numThreads)
+    {
+        if(A.rows() != A.cols() || blockSize == 0)
+            return false;
+
+        const int n = A.rows();
+        const unsigned int hardwareThreads = max(1u, thread::hardware_concurrency());
+        const unsigned int threads = numThreads == 0 ? hardwareThreads : numThreads;
+        bool nonSingular = true;
+
+        pivots.resize(n);
+
+        for(int k0 = 0; k0 < n; k0 += blockSize)
+        {
+            const int kb = min<int>(blockSize, n - k0);
+
+            // panel factorisation, unblocked with partial pivoting
+            for(int k = k0; k < k0 + kb; k++)
+            {
+                int p;
+                const double pivot = A.col(k).tail(n - k).cwiseAbs().maxCoeff(&p);
+                p += k;
+                pivots(k) = p;
+
+                if(p != k)
+                    A.row(k).swap(A.row(p));
+
+                if(pivot == 0.0){
+                    nonSingular = false;
+                    continue;
+                }
+
+                A.col(k).tail(n - k - 1) /= A(k, k);
+
+                const int panelCols = k0 + kb - k - 1;
+
+                if(panelCols > 0)
+                    A.block(k + 1, k + 1, n - k - 1, panelCols).noalias() -=
+                            A.col(k).tail(n - k - 1)*A.row(k).segment(k + 1, panelCols);
+            }
+
+            const int trailing = n - k0 - kb;
+
+            if(trailing == 0)
+                continue;
+
+            // U12 = L11^-1 A12 and A22 -= L21 U12, independent by columns
+            const unsigned int numChunks = min<unsigned int>(threads, (trailing + 31)/32);
+            const int chunkCols = (trailing + numChunks - 1)/numChunks;
+
+            auto updateColumns = [&A, k0, kb, n](const int& first, const int& numCols)
+            {
+                auto U12 = A.block(k0, first, kb, numCols);
+                A.block(k0, k0, kb, kb).triangularView<UnitLower>().solveInPlace(U12);
+                A.block(k0 + kb, first, n - k0 - kb, numCols).noalias() -=
+                        A.block(k0 + kb, k0, n - k0 - kb, kb)*U12;
+            };
+
+            vector<thread> workers;
+            workers.reserve(numChunks);
+
+            for(unsigned int c = 1; c < numChunks; c++)
+            {
+                const int first = k0 + kb + c*chunkCols;
+                const int numCols = min(chunkCols, n - first);
+
+                if(numCols > 0)
+                    workers.push_back(thread(updateColumns, first, numCols));
+            }
+
+            updateColumns(k0 + kb, min(chunkCols, trailing));
+
+            for(thread& worker : workers)
+                worker.join();
+        }
+
+        return nonSingular;
+    }
+
+    VectorXd SolveBlockedLU(const MatrixXd& LU,
+                            const VectorXi& pivots,
+                            const VectorXd& b)
+    {
+        VectorXd x = b;
+
+        for(int k = 0; k < pivots.size(); k++)
+            swap(x(k), x(pivots(k)));
+
+        LU.triangularView<UnitLower>().solveInPlace(x);
+        LU.triangularView<Upper>().solveInPlace(x);
+
+        return x;
+    }
+
+    VectorXd SolveSystemBlockedLU(const MatrixXd& A,
+                                  const VectorXd& b,
+                                  const unsigned int& blockSize,
+                                  const unsigned int& numThreads)
+    {
+        MatrixXd LU = A;
+        VectorXi pivots;
+
+        if(!BlockedLU(LU, pivots, blockSize, numThreads))
+            return VectorXd();
+
+        return SolveBlockedLU(LU, pivots, b);
+    }
+
+}
@@ -0,0 +1,39 @@
+#ifndef __DENSESOLVER_H
+#define __DENSESOLVER_H
+
+#include "Eigen/Eigen"
+
+using namespace std;
+using namespace Eigen;
+
+namespace LinearSystemLibrary {
+
+  /// \brief Factorise in place PA = LU with partial pivoting, blocked and multi-threaded.
+  /// Each block step factorises a panel of blockSize columns, then the triangular solve
+  /// and the update of the trailing matrix are split by columns among the threads
+  /// \param A: the matrix, overwritten by L (unit lower, below the diagonal) and U
+  /// \param pivots: the resulting row interchanges, row k was swapped with row pivots[k]
+  /// \param blockSize: the number of columns of each panel
+  /// \param numThreads: the number of threads, 0 uses all the hardware threads
+  /// \return the result of the factorisation, false if A is singular or not square
+  bool BlockedLU(MatrixXd& A,
+                 VectorXi& pivots,
+                 const unsigned int& blockSize = 128,
+                 const unsigned int& numThreads = 0);
+
+  /// \brief Solve the system LU x = Pb with the factors computed by BlockedLU
+  /// \return the solution
+  VectorXd SolveBlockedLU(const MatrixXd& LU,
+                          const VectorXi& pivots,
+                          const VectorXd& b);
+
+  /// \brief Solve linear system with the blocked multi-threaded PALU
+  /// \return the solution, empty if A is singular
+  VectorXd SolveSystemBlockedLU(const MatrixXd& A,
+                                const VectorXd& b,
+                                const unsigned int& blockSize = 128,
+                                const unsigned int& numThreads = 0);
+
+}
+
+#endif // __DENSESOLVER_H
@@ -0,0 +1,67 @@
+#ifndef __FIXEDSOLVER_H
+#define __FIXEDSOLVER_H
+
+#include "Eigen/Eigen"
+#include "staticSolver.hpp"
+
+using namespace std;
+using namespace Eigen;
+
+namespace LinearSystemLibrary {
+
+  /// \brief Copy a fixed-size Eigen matrix into row-major stack storage
+  template<int N>
+  StaticMatrix<N> ToStaticMatrix(const Matrix<double, N, N>& A)
+  {
+    StaticMatrix<N> staticA;
+
+    for(int i = 0; i < N; i++)
+      for(int j = 0; j < N; j++)
+        staticA[i][j] = A(i, j);
+
+    return staticA;
+  }
+
+  /// \brief Solve a small fixed-size linear system with PALU (full pivoting, like fullPivLu)
+  /// The factorisation works on stack copies of A and b, nothing is allocated
+  /// \return the solution
+  template<int N>
+  Matrix<double, N, 1> SolveSystemPALU(const Matrix<double, N, N>& A,
+                                       const Matrix<double, N, 1>& b)
+  {
+    StaticVector<N> staticB;
+    Map<Matrix<double, N, 1>>(staticB.data()) = b;
+
+    return Map<const Matrix<double, N, 1>>(SolveSystemPALU<N>(ToStaticMatrix<N>(A), staticB).data());
+  }
+
+  /// \brief Solve a small fixed-size linear system with QR (Householder with column pivoting,
+  /// like colPivHouseholderQr). The factorisation works on stack copies of A and b
+  /// \return the solution
+  template<int N>
+  Matrix<double, N, 1> SolveSystemQR(const Matrix<double, N, N>& A,
+                                     const Matrix<double, N, 1>& b)
+  {
+    StaticVector<N> staticB;
+    Map<Matrix<double, N, 1>>(staticB.data()) = b;
+
+    return Map<const Matrix<double, N, 1>>(SolveSystemQR<N>(ToStaticMatrix<N>(A), staticB).data());
+  }
+
+  /// \brief Test the real solution of the fixed-size system Ax = b
+  /// \return the relative error for PALU solver
+  /// \return the relative error for QR solver
+  template<int N>
+  void TestSolution(const Matrix<double, N, N>& A,
+                    const Matrix<double, N, 1>& b,
+                    const Matrix<double, N, 1>& solution,
+                    double& errRelPALU,
+                    double& errRelQR)
+  {
+    errRelPALU = (solution - SolveSystemPALU<N>(A, b)).norm()/solution.norm();
+    errRelQR = (solution - SolveSystemQR<N>(A, b)).norm()/solution.norm();
+  }
+
+}
+
+#endif // __FIXEDSOLVER_H
@@ -0,0 +1,84 @@
+#include "leastSquares.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace LinearSystemLibrary {
+
+    /// \brief Reduce the stacked rows to the (n + 1) x (n + 1) upper triangular R factor
+    MatrixXd ReduceToR(const MatrixXd& stacked,
+                       const unsigned int& cols)
+    {
+        const HouseholderQR<MatrixXd> qr(stacked);
+        const unsigned int rows = min<unsigned int>(stacked.rows(), cols);
+
+        MatrixXd R = MatrixXd::Zero(cols, cols);
+        R.topRows(rows) = qr.matrixQR().topRows(rows).triangularView<Upper>();
+
+        return R;
+    }
+
+    VectorXd SolveLeastSquaresTSQR(const MatrixXd& A,
+                                   const VectorXd& b,
+                                   double& residualNorm,
+                                   const unsigned int& numThreads,
+                                   const unsigned int& blockRows)
+    {
+        const unsigned int m = A.rows();
+        const unsigned int n = A.cols();
+
+        if(m < n || n == 0 || b.size() != m || blockRows == 0)
+            return VectorXd();
+
+        const unsigned int hardwareThreads = max(1u, thread::hardware_concurrency());
+        const unsigned int threads = min(numThreads == 0 ? hardwareThreads : numThreads,
+                                         max(1u, m/(n + 1)));
+        const unsigned int rowsPerThread = (m + threads - 1)/threads;
+
+        vector<MatrixXd> threadR(threads, MatrixXd::Zero(n + 1, n + 1));
+
+        auto reduceRows = [&](const unsigned int& t)
+        {
+            const unsigned int first = t*rowsPerThread;
+            const unsigned int last = min(m, first + rowsPerThread);
+            MatrixXd stacked;
+            MatrixXd& R = threadR[t];
+
+            for(unsigned int row = first; row < last; row += blockRows)
+            {
+                const unsigned int numRows = min(blockRows, last - row);
+
+                stacked.resize(numRows + n + 1, n + 1);
+                stacked.topRows(n + 1) = R;
+                stacked.block(n + 1, 0, numRows, n) = A.middleRows(row, numRows);
+                stacked.block(n + 1, n, numRows, 1) = b.segment(row, numRows);
+
+                R = ReduceToR(stacked, n + 1);
+            }
+        };
+
+        vector<thread> workers;
+
+        for(unsigned int t = 1; t < threads; t++)
+            workers.push_back(thread(reduceRows, t));
+
+        reduceRows(0);
+
+        for(thread& worker : workers)
+            worker.join();
+
+        MatrixXd stacked(threads*(n + 1), n + 1);
+
+        for(unsigned int t = 0; t < threads; t++)
+            stacked.middleRows(t*(n + 1), n + 1) = threadR[t];
+
+        const MatrixXd R = ReduceToR(stacked, n + 1);
+
+        // [A b] = Q R: the last column of R holds Q'b, its last entry the residual
+        residualNorm = abs(R(n, n));
+
+        return R.topLeftCorner(n, n).colPivHouseholderQr().solve(R.col(n).head(n));
+    }
+
+}
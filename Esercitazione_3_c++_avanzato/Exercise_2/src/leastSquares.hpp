@@ -0,0 +1,27 @@
+#ifndef __LEASTSQUARES_H
+#define __LEASTSQUARES_H
+
+#include "Eigen/Eigen"
+
+using namespace std;
+using namespace Eigen;
+
+namespace LinearSystemLibrary {
+
+  /// \brief Solve the least-squares problem min ||Ax - b|| for tall-skinny A (m >> n) with TSQR:
+  /// every thread reduces its rows, blockRows at a time, to the R factor of [A b],
+  /// the R factors of the threads are then stacked and reduced once more.
+  /// Only (blockRows + n + 1) x (n + 1) blocks are factorised, never the whole A
+  /// \param numThreads: the number of threads, 0 uses all the hardware threads
+  /// \param blockRows: the number of rows factorised at once by each thread
+  /// \param residualNorm: the resulting norm of Ax - b
+  /// \return the solution, empty if A has less rows than columns or b has wrong size
+  VectorXd SolveLeastSquaresTSQR(const MatrixXd& A,
+                                 const VectorXd& b,
+                                 double& residualNorm,
+                                 const unsigned int& numThreads = 0,
+                                 const unsigned int& blockRows = 4096);
+
+}
+
+#endif // __LEASTSQUARES_H
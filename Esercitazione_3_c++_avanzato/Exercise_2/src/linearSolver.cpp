@@ -0,0 +1,54 @@
+#include "linearSolver.hpp"
+
+namespace LinearSystemLibrary {
+
+    void LinearSolver::Compute(const MatrixXd& A)
+    {
+        matrix = A;
+        luComputed = false;
+        qrComputed = false;
+    }
+
+    const FullPivLU<MatrixXd>& LinearSolver::PALU()
+    {
+        if(!luComputed){
+            lu.compute(matrix);
+            luComputed = true;
+        }
+
+        return lu;
+    }
+
+    const ColPivHouseholderQR<MatrixXd>& LinearSolver::QR()
+    {
+        if(!qrComputed){
+            qr.compute(matrix);
+            qrComputed = true;
+        }
+
+        return qr;
+    }
+
+    MatrixXd LinearSolver::SolvePALU(const MatrixXd& B)
+    {
+        return PALU().solve(B);
+    }
+
+    MatrixXd LinearSolver::SolveQR(const MatrixXd& B)
+    {
+        return QR().solve(B);
+    }
+
+    void TestSolutions(const MatrixXd& A,
+                       const MatrixXd& B,
+                       const MatrixXd& solutions,
+                       VectorXd& errRelPALU,
+                       VectorXd& errRelQR)
+    {
+        LinearSolver solver(A);
+
+        errRelPALU = (solutions - solver.SolvePALU(B)).colwise().norm().cwiseQuotient(solutions.colwise().norm()).transpose();
+        errRelQR = (solutions - solver.SolveQR(B)).colwise().norm().cwiseQuotient(solutions.colwise().norm()).transpose();
+    }
+
+}
@@ -0,0 +1,55 @@
+#ifndef __LINEARSOLVER_H
+#define __LINEARSOLVER_H
+
+#include "Eigen/Eigen"
+
+using namespace std;
+using namespace Eigen;
+
+namespace LinearSystemLibrary {
+
+  /// \brief Solver for many right-hand sides against the same matrix:
+  /// the PALU and QR decompositions are computed once, when first needed, and then reused
+  class LinearSolver
+  {
+    MatrixXd matrix;
+    FullPivLU<MatrixXd> lu;
+    ColPivHouseholderQR<MatrixXd> qr;
+    bool luComputed = false;
+    bool qrComputed = false;
+
+    public:
+        LinearSolver() = default;
+        LinearSolver(const MatrixXd& A) : matrix(A) {}
+
+        /// \brief Compute set a new matrix, previous decompositions are discarded
+        void Compute(const MatrixXd& A);
+
+        /// \brief Solve the systems A X = B with PALU, one column of B per right-hand side
+        /// \return the solutions, one column per right-hand side
+        MatrixXd SolvePALU(const MatrixXd& B);
+
+        /// \brief Solve the systems A X = B with QR, one column of B per right-hand side
+        /// \return the solutions, one column per right-hand side
+        MatrixXd SolveQR(const MatrixXd& B);
+
+        /// \brief PALU the PALU decomposition of A, computed on first use
+        const FullPivLU<MatrixXd>& PALU();
+
+        /// \brief QR the QR decomposition of A, computed on first use
+        const ColPivHouseholderQR<MatrixXd>& QR();
+  };
+
+  /// \brief Test the real solutions of the systems A X = B, factorising A once per method
+  /// \param solutions: the real solutions, one column per right-hand side
+  /// \return the relative errors for PALU solver, one per right-hand side
+  /// \return the relative errors for QR solver, one per right-hand side
+  void TestSolutions(const MatrixXd& A,
+                     const MatrixXd& B,
+                     const MatrixXd& solutions,
+                     VectorXd& errRelPALU,
+                     VectorXd& errRelQR);
+
+}
+
+#endif // __LINEARSOLVER_H
@@ -0,0 +1,27 @@
+#include "linearSystem.hpp"
+
+namespace LinearSystemLibrary {
+
+    void TestSolution(const MatrixXd& A,
+                      const VectorXd& b,
+                      const VectorXd& solution,
+                      double& errRelPALU,
+                      double& errRelQR)
+    {
+        errRelPALU = (solution - SolveSystemPALU(A, b)).norm()/solution.norm();
+        errRelQR = (solution - SolveSystemQR(A, b)).norm()/solution.norm();
+    }
+
+    VectorXd SolveSystemPALU(const MatrixXd& A,
+                             const VectorXd& b)
+    {
+        return A.fullPivLu().solve(b);
+    }
+
+    VectorXd SolveSystemQR(const MatrixXd& A,
+                           const VectorXd& b)
+    {
+        return A.colPivHouseholderQr().solve(b);
+    }
+
+}
@@ -0,0 +1,32 @@
+#ifndef __LINEARSYSTEM_H
+#define __LINEARSYSTEM_H
+
+#include "Eigen/Eigen"
+
+using namespace std;
+using namespace Eigen;
+
+namespace LinearSystemLibrary {
+
+  /// \brief Test the real solution of system Ax = b
+  /// \return the relative error for PALU solver
+  /// \return the relative error for QR solver
+  void TestSolution(const MatrixXd& A,
+                    const VectorXd& b,
+                    const VectorXd& solution,
+                    double& errRelPALU,
+                    double& errRelQR);
+
+  /// \brief Solve linear system with PALU
+  /// \return the solution
+  VectorXd SolveSystemPALU(const MatrixXd& A,
+                           const VectorXd& b);
+
+  /// \brief Solve linear system with QR
+  /// \return the solution
+  VectorXd SolveSystemQR(const MatrixXd& A,
+                         const VectorXd& b);
+
+}
+
+#endif // __LINEARSYSTEM_H
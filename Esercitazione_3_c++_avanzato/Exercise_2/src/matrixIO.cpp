@@ -0,0 +1,208 @@
+#include "matrixIO.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+
+namespace LinearSystemLibrary {
+
+    /// \brief Largest dense matrix built from a Matrix Market file: 2^27 doubles, 1 GiB
+    const size_t MaxDenseValues = static_cast<size_t>(1) << 27;
+
+    /// \brief Read the banner and the size line of a Matrix Market file
+    /// \return false if the file is not a real/integer, general/symmetric Matrix Market matrix
+    /// or if it holds fewer bytes than the number of entries needs
+    bool ImportMatrixMarketHeader(ifstream& file,
+                                  bool& coordinate,
+                                  bool& symmetric,
+                                  unsigned int& rows,
+                                  unsigned int& cols,
+                                  size_t& numEntries)
+    {
+        string line;
+
+        if(!getline(file, line))
+            return false;
+
+        transform(line.begin(), line.end(), line.begin(), ::tolower);
+
+        istringstream banner(line);
+        string tag, object, format, field, symmetry;
+        banner >> tag >> object >> format >> field >> symmetry;
+
+        if(tag != "%%matrixmarket" || object != "matrix" ||
+           (field != "real" && field != "integer" && field != "double"))
+            return false;
+
+        coordinate = format == "coordinate";
+        symmetric = symmetry == "symmetric";
+
+        // skew-symmetric and hermitian files store half of a matrix which is not mirrored as is
+        if((!coordinate && format != "array") || (!symmetric && symmetry != "general"))
+            return false;
+
+        while(getline(file, line))
+            if(!line.empty() && line[0] != '%')
+                break;
+
+        istringstream size(line);
+        size >> rows >> cols;
+
+        // array files store the lower triangle of a symmetric matrix, the products are done in size_t
+        numEntries = symmetric ? static_cast<size_t>(rows)*(rows + 1)/2 : static_cast<size_t>(rows)*cols;
+
+        if(coordinate)
+            size >> numEntries;
+
+        if(size.fail() || (symmetric && rows != cols))
+            return false;
+
+        // the count is checked against the rest of the file before anything is allocated:
+        // an entry takes at least "v\n" in array format and "i j v\n" in coordinate format
+        const streampos dataBegin = file.tellg();
+
+        // the size line was the end of the file
+        if(dataBegin == streampos(-1))
+            return numEntries == 0;
+
+        file.seekg(0, ios::end);
+        const size_t remainingBytes = static_cast<size_t>(file.tellg() - dataBegin);
+        file.seekg(dataBegin);
+
+        return numEntries <= (remainingBytes + 1)/(coordinate ? 6 : 2);
+    }
+
+    bool ImportMatrixMarketEntries(const string& filePath,
+                                   unsigned int& rows,
+                                   unsigned int& cols,
+                                   vector<Triplet<double>>& entries)
+    {
+        ifstream file(filePath);
+
+        if(file.fail())
+            return false;
+
+        bool coordinate, symmetric;
+        size_t numEntries;
+
+        if(!ImportMatrixMarketHeader(file, coordinate, symmetric, rows, cols, numEntries) || !coordinate)
+            return false;
+
+        entries.clear();
+        entries.reserve(symmetric ? 2*numEntries : numEntries);
+
+        for(size_t e = 0; e < numEntries; e++)
+        {
+            unsigned int i, j;
+            double value;
+
+            if(!(file >> i >> j >> value) || i == 0 || j == 0 || i > rows || j > cols)
+                return false;
+
+            entries.push_back(Triplet<double>(i - 1, j - 1, value));
+
+            if(symmetric && i != j)
+                entries.push_back(Triplet<double>(j - 1, i - 1, value));
+        }
+
+        return true;
+    }
+
+    bool ImportMatrixMarket(const string& filePath,
+                            MatrixXd& A)
+    {
+        ifstream file(filePath);
+
+        if(file.fail())
+            return false;
+
+        bool coordinate, symmetric;
+        unsigned int rows, cols;
+        size_t numEntries;
+
+        if(!ImportMatrixMarketHeader(file, coordinate, symmetric, rows, cols, numEntries))
+            return false;
+
+        // a coordinate file of a few entries can describe any size, the dense matrix is capped instead
+        if(cols > 0 && rows > MaxDenseValues/cols)
+            return false;
+
+        A = MatrixXd::Zero(rows, cols);
+
+        if(coordinate)
+        {
+            file.close();
+
+            vector<Triplet<double>> entries;
+
+            if(!ImportMatrixMarketEntries(filePath, rows, cols, entries))
+                return false;
+
+            for(const Triplet<double>& entry : entries)
+                A(entry.row(), entry.col()) += entry.value();
+
+            return true;
+        }
+
+        // array format: column-major, only the lower triangle when symmetric
+        for(unsigned int j = 0; j < cols; j++)
+            for(unsigned int i = symmetric ? j : 0; i < rows; i++)
+            {
+                if(!(file >> A(i, j)))
+                    return false;
+
+                if(symmetric)
+                    A(j, i) = A(i, j);
+            }
+
+        return true;
+    }
+
+    bool ImportMatrix(const string& filePath,
+                      MatrixXd& A)
+    {
+        if(filePath.size() > 4 && filePath.compare(filePath.size() - 4, 4, ".mtx") == 0)
+            return ImportMatrixMarket(filePath, A);
+
+        ifstream file(filePath, ios::binary);
+
+        if(file.fail())
+            return false;
+
+        int64_t size[2];
+
+        if(!file.read(reinterpret_cast<char*>(size), sizeof(size)) || size[0] < 0 || size[1] < 0)
+            return false;
+
+        // the sizes are checked against the length of the file before allocating, a corrupt header must not allocate gigabytes
+        const streampos dataBegin = file.tellg();
+        file.seekg(0, ios::end);
+        const int64_t numValues = (file.tellg() - dataBegin)/static_cast<int64_t>(sizeof(double));
+        file.seekg(dataBegin);
+
+        if(size[1] > 0 && size[0] > numValues/size[1])
+            return false;
+
+        A.resize(size[0], size[1]);
+
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(A.data()), A.size()*sizeof(double)));
+    }
+
+    bool ExportMatrix(const string& filePath,
+                      const MatrixXd& A)
+    {
+        ofstream file(filePath, ios::binary);
+
+        if(file.fail())
+            return false;
+
+        const int64_t size[2] = {A.rows(), A.cols()};
+
+        file.write(reinterpret_cast<const char*>(size), sizeof(size));
+        file.write(reinterpret_cast<const char*>(A.data()), A.size()*sizeof(double));
+
+        return static_cast<bool>(file);
+    }
+
+}
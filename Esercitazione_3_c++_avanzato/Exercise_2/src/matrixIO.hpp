@@ -0,0 +1,41 @@
+#ifndef __MATRIXIO_H
+#define __MATRIXIO_H
+
+#include <string>
+#include <vector>
+#include "Eigen/Eigen"
+
+using namespace std;
+using namespace Eigen;
+
+namespace LinearSystemLibrary {
+
+  /// \brief Import a dense matrix. Files with extension .mtx are read as Matrix Market
+  /// (array or coordinate, general or symmetric: skew-symmetric and hermitian are rejected), every other file as binary:
+  /// two int64 with the number of rows and columns followed by the column-major doubles
+  /// \param filePath: the input file path
+  /// \param A: the resulting matrix
+  /// \return the result of the reading, true if is success, false otherwise
+  bool ImportMatrix(const string& filePath,
+                    MatrixXd& A);
+
+  /// \brief Export a dense matrix in the binary format read by ImportMatrix
+  /// \return the result of the writing, true if is success, false otherwise
+  bool ExportMatrix(const string& filePath,
+                    const MatrixXd& A);
+
+  /// \brief Import the entries of a Matrix Market file in coordinate format,
+  /// symmetric matrices are expanded to both triangles
+  /// \param filePath: the input file path
+  /// \param rows: the resulting number of rows
+  /// \param cols: the resulting number of columns
+  /// \param entries: the resulting non-zero entries, zero-based
+  /// \return the result of the reading, true if is success, false otherwise
+  bool ImportMatrixMarketEntries(const string& filePath,
+                                 unsigned int& rows,
+                                 unsigned int& cols,
+                                 vector<Triplet<double>>& entries);
+
+}
+
+#endif // __MATRIXIO_H
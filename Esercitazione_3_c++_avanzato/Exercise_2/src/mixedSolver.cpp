@@ -0,0 +1,68 @@
+#include "mixedSolver.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace LinearSystemLibrary {
+
+    VectorXd SolveSystemMixedPrecision(const MatrixXd& A,
+                                       const VectorXd& b,
+                                       MixedPrecisionInfo& info,
+                                       const unsigned int& maxIterations,
+                                       const double& tolerance)
+    {
+        info = MixedPrecisionInfo();
+
+        const PartialPivLU<MatrixXf> lu(A.cast<float>());
+        VectorXd x = lu.solve(b.cast<float>()).cast<double>();
+
+        // backward error test as in LAPACK dsgesv: ||r|| <= tolerance ||A|| ||x||
+        const double threshold = (tolerance > 0.0 ? tolerance : sqrt(A.rows())*numeric_limits<double>::epsilon())*
+                                 A.cwiseAbs().rowwise().sum().maxCoeff();
+        double previousCorrection = numeric_limits<double>::infinity();
+
+        while(true)
+        {
+            const VectorXd residual = b - A*x;
+
+            if(residual.lpNorm<Infinity>() <= threshold*x.lpNorm<Infinity>()){
+                info.Converged = true;
+                break;
+            }
+
+            if(info.Iterations == maxIterations)
+                break;
+
+            const VectorXd correction = lu.solve(residual.cast<float>()).cast<double>();
+            const double correctionNorm = correction.lpNorm<Infinity>();
+
+            // the corrections stop shrinking: cond(A) is too large for the float factors
+            if(!(correctionNorm < previousCorrection))
+                break;
+
+            x += correction;
+            info.Iterations++;
+            previousCorrection = correctionNorm;
+        }
+
+        // the float factors are not accurate enough for this A
+        if(!info.Converged){
+            info.DoubleFallback = true;
+            x = PartialPivLU<MatrixXd>(A).solve(b);
+        }
+
+        return x;
+    }
+
+    void TestSolutionMixedPrecision(const MatrixXd& A,
+                                    const VectorXd& b,
+                                    const VectorXd& solution,
+                                    double& errRel,
+                                    unsigned int& iterations)
+    {
+        MixedPrecisionInfo info;
+        errRel = (solution - SolveSystemMixedPrecision(A, b, info)).norm()/solution.norm();
+        iterations = info.Iterations;
+    }
+
+}
@@ -0,0 +1,45 @@
+#ifndef __MIXEDSOLVER_H
+#define __MIXEDSOLVER_H
+
+#include "Eigen/Eigen"
+
+using namespace std;
+using namespace Eigen;
+
+namespace LinearSystemLibrary {
+
+  /// \brief Outcome of the mixed-precision solver
+  struct MixedPrecisionInfo
+  {
+    bool Converged = false; ///< the refinement reached the tolerance
+    unsigned int Iterations = 0; ///< number of refinement steps
+    bool DoubleFallback = false; ///< the refinement did not converge and A was factorised again in double precision
+  };
+
+  /// \brief Solve linear system factorising A in single precision (PALU with partial pivoting)
+  /// and recovering double accuracy by iterative refinement with double residuals.
+  /// Refinement converges when cond(A) is well below 1/eps of float (about 1e7): when it stalls or reaches
+  /// maxIterations the system is solved again with a double precision PALU, as LAPACK dsgesv does
+  /// \param info: the resulting number of iterations and convergence flag
+  /// \param maxIterations: the maximum number of refinement steps
+  /// \param tolerance: stop when ||b - Ax|| <= tolerance ||A|| ||x|| (infinity norms),
+  /// 0 uses sqrt(n) eps like LAPACK dsgesv
+  /// \return the solution
+  VectorXd SolveSystemMixedPrecision(const MatrixXd& A,
+                                     const VectorXd& b,
+                                     MixedPrecisionInfo& info,
+                                     const unsigned int& maxIterations = 30,
+                                     const double& tolerance = 0.0);
+
+  /// \brief Test the real solution of system Ax = b with the mixed-precision solver
+  /// \return the relative error
+  /// \return the number of refinement steps
+  void TestSolutionMixedPrecision(const MatrixXd& A,
+                                  const VectorXd& b,
+                                  const VectorXd& solution,
+                                  double& errRel,
+                                  unsigned int& iterations);
+
+}
+
+#endif // __MIXEDSOLVER_H
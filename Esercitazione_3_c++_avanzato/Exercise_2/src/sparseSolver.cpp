@@ -0,0 +1,164 @@
+#include "sparseSolver.hpp"
+
+#include <algorithm>
+
+namespace LinearSystemLibrary {
+
+    CsrMatrix CsrFromTriplets(const int& rows,
+                              const int& cols,
+                              const vector<Triplet<double>>& entries)
+    {
+        SparseMatrix<double, RowMajor> matrix(rows, cols);
+        matrix.setFromTriplets(entries.begin(), entries.end());
+        matrix.makeCompressed();
+
+        CsrMatrix A;
+        A.Rows = rows;
+        A.Cols = cols;
+        A.RowOffsets.assign(matrix.outerIndexPtr(), matrix.outerIndexPtr() + rows + 1);
+        A.ColIndices.assign(matrix.innerIndexPtr(), matrix.innerIndexPtr() + matrix.nonZeros());
+        A.Values.assign(matrix.valuePtr(), matrix.valuePtr() + matrix.nonZeros());
+
+        return A;
+    }
+
+    Map<const SparseMatrix<double, RowMajor>> MapCsr(const CsrMatrix& A)
+    {
+        return Map<const SparseMatrix<double, RowMajor>>(A.Rows, A.Cols, A.Values.size(),
+                                                         A.RowOffsets.data(), A.ColIndices.data(),
+                                                         A.Values.data());
+    }
+
+    bool IsSymmetric(const CsrMatrix& A)
+    {
+        if(A.Rows != A.Cols)
+            return false;
+
+        for(int i = 0; i < A.Rows; i++)
+            for(int k = A.RowOffsets[i]; k < A.RowOffsets[i + 1]; k++)
+            {
+                const int j = A.ColIndices[k];
+
+                // each pair is checked from the lower triangle only
+                if(j >= i)
+                    continue;
+
+                const int* rowBegin = A.ColIndices.data() + A.RowOffsets[j];
+                const int* rowEnd = A.ColIndices.data() + A.RowOffsets[j + 1];
+                const int* mirror = lower_bound(rowBegin, rowEnd, i);
+
+                if(mirror == rowEnd || *mirror != i || A.Values[mirror - A.ColIndices.data()] != A.Values[k])
+                    return false;
+            }
+
+        // every lower entry has its upper mirror: the upper triangle has no other entry if the counts match
+        size_t lower = 0, upper = 0;
+
+        for(int i = 0; i < A.Rows; i++)
+            for(int k = A.RowOffsets[i]; k < A.RowOffsets[i + 1]; k++)
+            {
+                lower += A.ColIndices[k] < i;
+                upper += A.ColIndices[k] > i;
+            }
+
+        return lower == upper;
+    }
+
+    /// \brief Run an iterative solver and fill info
+    template<typename Solver, typename Matrix>
+    VectorXd SolveIterative(const Matrix& A,
+                            const VectorXd& b,
+                            SparseSolverInfo& info,
+                            const double& tolerance,
+                            const unsigned int& maxIterations)
+    {
+        Solver solver;
+        solver.setTolerance(tolerance);
+
+        if(maxIterations > 0)
+            solver.setMaxIterations(maxIterations);
+
+        solver.compute(A);
+
+        if(solver.info() != Success)
+            return VectorXd();
+
+        const VectorXd x = solver.solve(b);
+
+        info.Success = solver.info() == Success;
+        info.Iterations = solver.iterations();
+        info.Error = solver.error();
+
+        return x;
+    }
+
+    VectorXd SolveSystemSparse(const CsrMatrix& A,
+                               const VectorXd& b,
+                               const SparseMethod& method,
+                               SparseSolverInfo& info,
+                               const SparsePreconditioner& preconditioner,
+                               const double& tolerance,
+                               const unsigned int& maxIterations)
+    {
+        info = SparseSolverInfo();
+
+        if(A.Rows != A.Cols || b.size() != A.Rows || A.RowOffsets.size() != static_cast<size_t>(A.Rows) + 1)
+            return VectorXd();
+
+        // for symmetric matrices the CSR arrays are also the CSC arrays: LDLT and CG read them so
+        if((method == SparseMethod::LDLT || method == SparseMethod::CG) && !IsSymmetric(A))
+            return VectorXd();
+
+        const Map<const SparseMatrix<double, RowMajor>> rowMajor = MapCsr(A);
+        const Map<const SparseMatrix<double>> colMajor(A.Rows, A.Cols, A.Values.size(),
+                                                       A.RowOffsets.data(), A.ColIndices.data(),
+                                                       A.Values.data());
+
+        switch(method)
+        {
+            case SparseMethod::LU:
+            {
+                SparseLU<SparseMatrix<double>> solver;
+                solver.compute(SparseMatrix<double>(rowMajor));
+
+                if(solver.info() != Success)
+                    return VectorXd();
+
+                const VectorXd x = solver.solve(b);
+                info.Success = solver.info() == Success;
+
+                return x;
+            }
+            case SparseMethod::LDLT:
+            {
+                SimplicialLDLT<SparseMatrix<double>> solver;
+                solver.compute(colMajor);
+
+                if(solver.info() != Success)
+                    return VectorXd();
+
+                const VectorXd x = solver.solve(b);
+                info.Success = solver.info() == Success;
+
+                return x;
+            }
+            case SparseMethod::CG:
+            {
+                if(preconditioner == SparsePreconditioner::Incomplete)
+                    return SolveIterative<ConjugateGradient<SparseMatrix<double>, Lower|Upper, IncompleteCholesky<double>>>(colMajor, b, info, tolerance, maxIterations);
+
+                return SolveIterative<ConjugateGradient<SparseMatrix<double>, Lower|Upper>>(colMajor, b, info, tolerance, maxIterations);
+            }
+            case SparseMethod::BiCGSTAB:
+            {
+                if(preconditioner == SparsePreconditioner::Incomplete)
+                    return SolveIterative<BiCGSTAB<SparseMatrix<double, RowMajor>, IncompleteLUT<double>>>(rowMajor, b, info, tolerance, maxIterations);
+
+                return SolveIterative<BiCGSTAB<SparseMatrix<double, RowMajor>>>(rowMajor, b, info, tolerance, maxIterations);
+            }
+        }
+
+        return VectorXd();
+    }
+
+}
@@ -0,0 +1,75 @@
+#ifndef __SPARSESOLVER_H
+#define __SPARSESOLVER_H
+
+#include <vector>
+#include "Eigen/Eigen"
+
+using namespace std;
+using namespace Eigen;
+
+namespace LinearSystemLibrary {
+
+  /// \brief Sparse matrix in compressed sparse row format:
+  /// the entries of row i are ColIndices/Values[RowOffsets[i], RowOffsets[i + 1])
+  struct CsrMatrix
+  {
+    int Rows = 0;
+    int Cols = 0;
+    vector<int> RowOffsets;
+    vector<int> ColIndices;
+    vector<double> Values;
+  };
+
+  enum class SparseMethod
+  {
+    LU,       ///< SparseLU, any square non-singular matrix
+    LDLT,     ///< SimplicialLDLT, symmetric matrices
+    CG,       ///< ConjugateGradient, symmetric positive definite matrices
+    BiCGSTAB  ///< BiCGSTAB, any square matrix
+  };
+
+  enum class SparsePreconditioner
+  {
+    Diagonal,  ///< Jacobi preconditioner
+    Incomplete ///< IncompleteCholesky for CG, IncompleteLUT for BiCGSTAB
+  };
+
+  /// \brief Outcome of a sparse solve, Iterations and Error are set only by the iterative methods
+  struct SparseSolverInfo
+  {
+    bool Success = false;
+    unsigned int Iterations = 0;
+    double Error = 0.0;
+  };
+
+  /// \brief Build a CSR matrix from its entries, duplicated entries are summed
+  CsrMatrix CsrFromTriplets(const int& rows,
+                            const int& cols,
+                            const vector<Triplet<double>>& entries);
+
+  /// \brief Map a CSR matrix as Eigen row-major sparse matrix, nothing is copied
+  Map<const SparseMatrix<double, RowMajor>> MapCsr(const CsrMatrix& A);
+
+  /// \brief Check that a square CSR matrix is symmetric, entry by entry: each (i, j, v) needs (j, i, v).
+  /// The column indices of each row must be sorted, as built by CsrFromTriplets
+  bool IsSymmetric(const CsrMatrix& A);
+
+  /// \brief Solve sparse linear system without densifying it.
+  /// CG and BiCGSTAB read the CSR arrays in place (for symmetric matrices they are also
+  /// the column-major arrays), the direct methods build their own sparse factors.
+  /// LDLT and CG fail (info.Success false, empty solution) on a matrix which is not symmetric (see IsSymmetric),
+  /// which they would solve as its transpose
+  /// \param tolerance: the relative residual tolerance of the iterative methods
+  /// \param maxIterations: the maximum number of iterations of the iterative methods, 0 is Eigen default
+  /// \return the solution
+  VectorXd SolveSystemSparse(const CsrMatrix& A,
+                             const VectorXd& b,
+                             const SparseMethod& method,
+                             SparseSolverInfo& info,
+                             const SparsePreconditioner& preconditioner = SparsePreconditioner::Diagonal,
+                             const double& tolerance = 1e-12,
+                             const unsigned int& maxIterations = 0);
+
+}
+
+#endif // __SPARSESOLVER_H
@@ -0,0 +1,267 @@
+#ifndef __STATICSOLVER_H
+#define __STATICSOLVER_H
+
+#include <array>
+#include <cmath>
+#include <utility>
+
+using namespace std;
+
+namespace LinearSystemLibrary {
+
+  /// \brief N x N matrix stored by rows on the stack
+  template<size_t N>
+  using StaticMatrix = array<array<double, N>, N>;
+
+  template<size_t N>
+  using StaticVector = array<double, N>;
+
+  namespace StaticInternal {
+
+    /// \brief Every array used by SolveSystemPALU<N>: the steps and the back substitution
+    /// work on these members and declare no array of their own
+    template<size_t N>
+    struct PALUFrame
+    {
+      StaticMatrix<N> LU; ///< the factorised copy of A
+      StaticVector<N> y; ///< the copy of b, transformed with A
+      array<size_t, N> permutation; ///< the column permutation
+      StaticVector<N> z; ///< the permuted solution
+      StaticVector<N> x; ///< the solution
+    };
+
+    /// \brief Every array used by SolveSystemQR<N>, see PALUFrame
+    template<size_t N>
+    struct QRFrame
+    {
+      StaticMatrix<N> R;
+      StaticVector<N> y;
+      array<size_t, N> permutation;
+      StaticVector<N> v; ///< the Householder vector of the current step
+      StaticVector<N> z;
+      StaticVector<N> x;
+    };
+
+    /// \brief Call f(Begin), f(Begin + 1), ..., f(End - 1) with compile-time constant arguments
+    template<size_t Begin, size_t End, bool Done = (Begin >= End)>
+    struct Unroll
+    {
+      template<typename F>
+      static inline void Run(const F& f)
+      {
+        f(Begin);
+        Unroll<Begin + 1, End>::Run(f);
+      }
+    };
+
+    template<size_t Begin, size_t End>
+    struct Unroll<Begin, End, true>
+    {
+      template<typename F>
+      static inline void Run(const F&) {}
+    };
+
+    /// \brief Swap the columns k and q of A
+    template<size_t N>
+    inline void SwapColumns(StaticMatrix<N>& A, const size_t& k, const size_t& q)
+    {
+      Unroll<0, N>::Run([&](const size_t& i) { swap(A[i][k], A[i][q]); });
+    }
+
+    /// \brief Solve U z = y with U upper triangular and x = z permuted back,
+    /// the free unknowns of a singular system are set to zero
+    template<size_t N>
+    inline void BackSubstitution(const StaticMatrix<N>& U,
+                                 const StaticVector<N>& y,
+                                 const array<size_t, N>& permutation,
+                                 StaticVector<N>& z,
+                                 StaticVector<N>& x)
+    {
+      Unroll<0, N>::Run([&](const size_t& r)
+      {
+        const size_t i = N - 1 - r;
+        double sum = y[i];
+
+        // the condition is a constant once unrolled, the dead terms are not emitted
+        Unroll<0, N>::Run([&](const size_t& j) { sum -= j > i ? U[i][j]*z[j] : 0.0; });
+
+        z[i] = U[i][i] != 0.0 ? sum/U[i][i] : 0.0;
+      });
+
+      Unroll<0, N>::Run([&](const size_t& i) { x[permutation[i]] = z[i]; });
+    }
+
+    /// \brief Step K of the PALU with full pivoting, then the following steps
+    template<size_t N, size_t K, bool Done = (K >= N)>
+    struct PALUStep
+    {
+      static inline void Run(StaticMatrix<N>& LU,
+                             StaticVector<N>& y,
+                             array<size_t, N>& permutation)
+      {
+        size_t p = K, q = K;
+        double pivot = 0.0;
+
+        Unroll<K, N>::Run([&](const size_t& j)
+        {
+          Unroll<K, N>::Run([&](const size_t& i)
+          {
+            const double candidate = fabs(LU[i][j]);
+            const bool larger = candidate > pivot;
+            pivot = larger ? candidate : pivot;
+            p = larger ? i : p;
+            q = larger ? j : q;
+          });
+        });
+
+        if(pivot != 0.0)
+        {
+          swap(LU[K], LU[p]);
+          swap(y[K], y[p]);
+          SwapColumns<N>(LU, K, q);
+          swap(permutation[K], permutation[q]);
+
+          Unroll<K + 1, N>::Run([&](const size_t& i)
+          {
+            const double l = LU[i][K]/LU[K][K];
+
+            Unroll<K + 1, N>::Run([&](const size_t& j) { LU[i][j] -= l*LU[K][j]; });
+
+            y[i] -= l*y[K];
+          });
+        }
+
+        PALUStep<N, K + 1>::Run(LU, y, permutation);
+      }
+    };
+
+    template<size_t N, size_t K>
+    struct PALUStep<N, K, true>
+    {
+      static inline void Run(StaticMatrix<N>&, StaticVector<N>&, array<size_t, N>&) {}
+    };
+
+    /// \brief Step K of the Householder QR with column pivoting, then the following steps
+    template<size_t N, size_t K, bool Done = (K >= N)>
+    struct QRStep
+    {
+      static inline void Run(StaticMatrix<N>& R,
+                             StaticVector<N>& y,
+                             array<size_t, N>& permutation,
+                             StaticVector<N>& v)
+      {
+        size_t q = K;
+        double maxNorm = -1.0;
+
+        Unroll<K, N>::Run([&](const size_t& j)
+        {
+          double norm = 0.0;
+
+          Unroll<K, N>::Run([&](const size_t& i) { norm += R[i][j]*R[i][j]; });
+
+          const bool larger = norm > maxNorm;
+          maxNorm = larger ? norm : maxNorm;
+          q = larger ? j : q;
+        });
+
+        SwapColumns<N>(R, K, q);
+        swap(permutation[K], permutation[q]);
+
+        if(K + 1 < N && maxNorm > 0.0)
+        {
+          // Householder reflector v = x - alpha e_1 annihilating R(K+1:N, K)
+          const double alpha = R[K][K] > 0.0 ? -sqrt(maxNorm) : sqrt(maxNorm);
+          double vNorm = 0.0;
+
+          Unroll<K, N>::Run([&](const size_t& i) { v[i] = R[i][K]; });
+          v[K] -= alpha;
+          Unroll<K, N>::Run([&](const size_t& i) { vNorm += v[i]*v[i]; });
+
+          if(vNorm != 0.0)
+          {
+            Unroll<K, N>::Run([&](const size_t& j)
+            {
+              double w = 0.0;
+
+              Unroll<K, N>::Run([&](const size_t& i) { w += v[i]*R[i][j]; });
+
+              w *= 2.0/vNorm;
+
+              Unroll<K, N>::Run([&](const size_t& i) { R[i][j] -= w*v[i]; });
+            });
+
+            double w = 0.0;
+
+            Unroll<K, N>::Run([&](const size_t& i) { w += v[i]*y[i]; });
+
+            w *= 2.0/vNorm;
+
+            Unroll<K, N>::Run([&](const size_t& i) { y[i] -= w*v[i]; });
+          }
+        }
+
+        QRStep<N, K + 1>::Run(R, y, permutation, v);
+      }
+    };
+
+    template<size_t N, size_t K>
+    struct QRStep<N, K, true>
+    {
+      static inline void Run(StaticMatrix<N>&, StaticVector<N>&, array<size_t, N>&, StaticVector<N>&) {}
+    };
+
+  }
+
+  /// \brief Bytes of stack used by the arrays of the static solvers for a N x N system,
+  /// the size of the larger frame (QR: it also holds the Householder vector)
+  template<size_t N>
+  constexpr size_t StaticSolverStackBytes()
+  {
+    return sizeof(StaticInternal::PALUFrame<N>) > sizeof(StaticInternal::QRFrame<N>) ?
+           sizeof(StaticInternal::PALUFrame<N>) : sizeof(StaticInternal::QRFrame<N>);
+  }
+
+  /// \brief Solve linear system with PALU (full pivoting), every loop unrolled at compile time
+  /// \return the solution
+  template<size_t N>
+  StaticVector<N> SolveSystemPALU(const StaticMatrix<N>& A,
+                                  const StaticVector<N>& b)
+  {
+    static_assert(N >= 1 && N <= 8, "static solvers are meant for systems up to 8x8");
+    static_assert(StaticSolverStackBytes<N>() <= 1024, "static solver stack footprint above 1 KiB");
+
+    StaticInternal::PALUFrame<N> frame;
+    frame.LU = A;
+    frame.y = b;
+
+    StaticInternal::Unroll<0, N>::Run([&](const size_t& i) { frame.permutation[i] = i; });
+    StaticInternal::PALUStep<N, 0>::Run(frame.LU, frame.y, frame.permutation);
+    StaticInternal::BackSubstitution<N>(frame.LU, frame.y, frame.permutation, frame.z, frame.x);
+
+    return frame.x;
+  }
+
+  /// \brief Solve linear system with QR (Householder with column pivoting),
+  /// every loop unrolled at compile time
+  /// \return the solution
+  template<size_t N>
+  StaticVector<N> SolveSystemQR(const StaticMatrix<N>& A,
+                                const StaticVector<N>& b)
+  {
+    static_assert(N >= 1 && N <= 8, "static solvers are meant for systems up to 8x8");
+    static_assert(StaticSolverStackBytes<N>() <= 1024, "static solver stack footprint above 1 KiB");
+
+    StaticInternal::QRFrame<N> frame;
+    frame.R = A;
+    frame.y = b;
+
+    StaticInternal::Unroll<0, N>::Run([&](const size_t& i) { frame.permutation[i] = i; });
+    StaticInternal::QRStep<N, 0>::Run(frame.R, frame.y, frame.permutation, frame.v);
+    StaticInternal::BackSubstitution<N>(frame.R, frame.y, frame.permutation, frame.z, frame.x);
+
+    return frame.x;
+  }
+
+}
+
+#endif // __STATICSOLVER_H
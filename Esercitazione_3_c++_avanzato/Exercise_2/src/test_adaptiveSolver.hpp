@@ -0,0 +1,54 @@
+#ifndef __TEST_ADAPTIVESOLVER_H
+#define __TEST_ADAPTIVESOLVER_H
+
+#include <gtest/gtest.h>
+#include "adaptiveSolver.hpp"
+
+using namespace testing;
+using namespace Eigen;
+using namespace LinearSystemLibrary;
+
+TEST(TestAdaptiveSolver, TestSystems2x2)
+{
+  const Vector2d solution(-1.0, -1.0);
+  AdaptiveSolverInfo info;
+
+  Matrix2d A1;
+  A1 << 5.547001962252291e-01,-3.770900990025203e-02, 8.320502943378437e-01,-9.992887623566787e-01;
+  Vector2d b1(-5.169911863249772e-01, 1.672384680188350e-01);
+
+  EXPECT_LT((SolveSystemAdaptive(A1, b1, info) - solution).norm()/solution.norm(), 1e-15);
+  EXPECT_EQ(info.Method, AdaptiveMethod::PartialPivLU);
+
+  Matrix2d A3;
+  A3 << 5.547001962252291e-01,-5.547001955851905e-01, 8.320502943378437e-01,-8.320502947645361e-01;
+  Vector2d b3(-6.400391328043042e-10, 4.266924591433963e-10);
+
+  EXPECT_LT((SolveSystemAdaptive(A3, b3, info) - solution).norm()/solution.norm(), 1e-5);
+  EXPECT_EQ(info.Method, AdaptiveMethod::FullPivLU);
+  EXPECT_LT(info.ReciprocalCondition, 1e-8);
+}
+
+TEST(TestAdaptiveSolver, TestDynamic)
+{
+  srand(6);
+  AdaptiveSolverInfo info;
+
+  const MatrixXd A = MatrixXd::Random(50, 50) + 50*MatrixXd::Identity(50, 50);
+  const VectorXd solution = VectorXd::Ones(50);
+
+  EXPECT_LT((SolveSystemAdaptive(A, A*solution, info) - solution).norm()/solution.norm(), 1e-14);
+  EXPECT_EQ(info.Method, AdaptiveMethod::PartialPivLU);
+
+  // Hilbert matrix, cond ~ 1e13
+  MatrixXd H(10, 10);
+  for(unsigned int i = 0; i < 10; i++)
+    for(unsigned int j = 0; j < 10; j++)
+      H(i, j) = 1.0/(i + j + 1);
+
+  const VectorXd solutionH = VectorXd::Ones(10);
+  EXPECT_LT((SolveSystemAdaptive(H, H*solutionH, info) - solutionH).norm()/solutionH.norm(), 1e-2);
+  EXPECT_EQ(info.Method, AdaptiveMethod::FullPivLU);
+}
+
+#endif // __TEST_ADAPTIVESOLVER_H
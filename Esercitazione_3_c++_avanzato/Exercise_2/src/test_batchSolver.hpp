@@ -0,0 +1,70 @@
+#ifndef __TEST_BATCHSOLVER_H
+#define __TEST_BATCHSOLVER_H
+
+#include <gtest/gtest.h>
+#include "batchSolver.hpp"
+#include "linearSystem.hpp"
+
+using namespace testing;
+using namespace Eigen;
+using namespace LinearSystemLibrary;
+
+TEST(TestBatchSolver, TestAgainstPALU)
+{
+  srand(2);
+  SystemsBatch2x2 systems;
+
+  for(unsigned int i = 0; i < 1000; i++)
+  {
+    const Vector4d a = Vector4d::Random();
+    const Vector2d b = Vector2d::Random();
+    systems.A11.push_back(a(0));
+    systems.A12.push_back(a(1));
+    systems.A21.push_back(a(2));
+    systems.A22.push_back(a(3));
+    systems.B1.push_back(b(0));
+    systems.B2.push_back(b(1));
+  }
+
+  SolutionsBatch2x2 solutions;
+  ASSERT_TRUE(SolveBatch2x2(systems, solutions));
+  ASSERT_EQ(solutions.X1.size(), 1000u);
+
+  for(unsigned int i = 0; i < 1000; i++)
+  {
+    MatrixXd A(2, 2);
+    A << systems.A11[i], systems.A12[i], systems.A21[i], systems.A22[i];
+    VectorXd b(2);
+    b << systems.B1[i], systems.B2[i];
+
+    const VectorXd reference = SolveSystemPALU(A, b);
+    const double condition = A.colwise().lpNorm<1>().maxCoeff()*A.inverse().colwise().lpNorm<1>().maxCoeff();
+
+    EXPECT_LT((Vector2d(solutions.X1[i], solutions.X2[i]) - reference).norm(), 1e-9*reference.norm());
+    EXPECT_NEAR(solutions.Condition[i], condition, 1e-9*condition);
+  }
+}
+
+TEST(TestBatchSolver, TestSingularAndWrongSizes)
+{
+  SystemsBatch2x2 systems;
+  systems.A11 = {1.0, 0.0};
+  systems.A12 = {2.0, 1.0};
+  systems.A21 = {2.0, 1.0};
+  systems.A22 = {4.0, 0.0};
+  systems.B1 = {1.0, 3.0};
+  systems.B2 = {1.0, 2.0};
+
+  SolutionsBatch2x2 solutions;
+  ASSERT_TRUE(SolveBatch2x2(systems, solutions));
+
+  EXPECT_TRUE(std::isinf(solutions.Condition[0]));
+  EXPECT_DOUBLE_EQ(solutions.X1[1], 2.0);
+  EXPECT_DOUBLE_EQ(solutions.X2[1], 3.0);
+  EXPECT_DOUBLE_EQ(solutions.Condition[1], 1.0);
+
+  systems.B2.pop_back();
+  EXPECT_FALSE(SolveBatch2x2(systems, solutions));
+}
+
+#endif // __TEST_BATCHSOLVER_H
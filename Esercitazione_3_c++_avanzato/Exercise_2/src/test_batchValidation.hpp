@@ -0,0 +1,66 @@
+#ifndef __TEST_BATCHVALIDATION_H
+#define __TEST_BATCHVALIDATION_H
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <limits>
+#include "batchValidation.hpp"
+#include "linearSystem.hpp"
+
+using namespace testing;
+using namespace Eigen;
+using namespace LinearSystemLibrary;
+
+TEST(TestBatchValidation, TestParallelErrors)
+{
+  srand(8);
+  vector<TestSystem> systems;
+
+  for(unsigned int s = 0; s < 200; s++)
+  {
+    TestSystem system;
+    const unsigned int n = 2 + s % 7;
+    system.A = MatrixXd::Random(n, n);
+    system.Solution = VectorXd::Random(n);
+    system.b = system.A*system.Solution;
+    systems.push_back(system);
+  }
+
+  ASSERT_TRUE(ExportTestSystems("test_systems.txt", systems));
+
+  vector<TestSystem> imported;
+  ASSERT_TRUE(ImportTestSystems("test_systems.txt", imported));
+  ASSERT_EQ(imported.size(), 200u);
+
+  VectorXd errRelPALU, errRelQR;
+  TestSolutions(imported, errRelPALU, errRelQR, 4);
+
+  for(unsigned int s = 0; s < 200; s++)
+  {
+    double errPALU, errQR;
+    TestSolution(imported[s].A, imported[s].b, imported[s].Solution, errPALU, errQR);
+    EXPECT_EQ(errRelPALU(s), errPALU);
+    EXPECT_EQ(errRelQR(s), errQR);
+  }
+
+  // a size larger than the rest of the file is rejected before allocating
+  ofstream("test_systems_huge.txt") << "100000\n1 2\n3 4\n";
+  EXPECT_FALSE(ImportTestSystems("test_systems_huge.txt", imported));
+}
+
+TEST(TestBatchValidation, TestHistogram)
+{
+  VectorXd errors(8);
+  errors << 0.0, 1e-20, 3e-16, 5e-5, 2.0, numeric_limits<double>::quiet_NaN(),
+            1e300, numeric_limits<double>::infinity();
+
+  const ErrorHistogram histogram = BuildErrorHistogram(errors);
+
+  EXPECT_EQ(histogram.Counts[0], 2u);
+  EXPECT_EQ(histogram.Counts[-16 - histogram.MinExponent], 1u);
+  EXPECT_EQ(histogram.Counts[-5 - histogram.MinExponent], 1u);
+  EXPECT_EQ(histogram.Counts.back(), 3u);
+  EXPECT_EQ(histogram.NotANumber, 1u);
+}
+
+#endif // __TEST_BATCHVALIDATION_H
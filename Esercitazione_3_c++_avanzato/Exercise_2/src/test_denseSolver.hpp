@@ -0,0 +1,98 @@
+#ifndef __TEST_DENSESOLVER_H
+#define __TEST_DENSESOLVER_H
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <fstream>
+#include "denseSolver.hpp"
+#include "matrixIO.hpp"
+
+using namespace testing;
+using namespace Eigen;
+using namespace LinearSystemLibrary;
+
+TEST(TestDenseSolver, TestBlockedLU)
+{
+  srand(4);
+  const MatrixXd A = MatrixXd::Random(300, 300);
+  const VectorXd solution = VectorXd::Ones(300);
+  const VectorXd b = A*solution;
+
+  const VectorXd reference = A.partialPivLu().solve(b);
+
+  for(unsigned int blockSize : {1u, 7u, 64u, 500u})
+    for(unsigned int numThreads : {1u, 3u})
+    {
+      const VectorXd x = SolveSystemBlockedLU(A, b, blockSize, numThreads);
+      ASSERT_EQ(x.size(), 300);
+      EXPECT_LT((x - reference).norm(), 1e-10*reference.norm());
+    }
+
+  MatrixXd LU = A;
+  VectorXi pivots;
+  ASSERT_TRUE(BlockedLU(LU, pivots, 32, 2));
+
+  const PartialPivLU<MatrixXd> lu(A);
+  EXPECT_LT((LU - lu.matrixLU()).norm(), 1e-10*A.norm());
+}
+
+TEST(TestDenseSolver, TestSingular)
+{
+  MatrixXd A = MatrixXd::Ones(5, 5);
+  VectorXi pivots;
+  EXPECT_FALSE(BlockedLU(A, pivots));
+
+  MatrixXd B = MatrixXd::Ones(5, 4);
+  EXPECT_FALSE(BlockedLU(B, pivots));
+}
+
+TEST(TestDenseSolver, TestMatrixIO)
+{
+  srand(5);
+  const MatrixXd A = MatrixXd::Random(6, 4);
+  MatrixXd B;
+
+  ASSERT_TRUE(ExportMatrix("matrix_io.bin", A));
+  ASSERT_TRUE(ImportMatrix("matrix_io.bin", B));
+  EXPECT_EQ(A, B);
+
+  ofstream("matrix_array.mtx") << "%%MatrixMarket matrix array real general\n% comment\n2 2\n1\n3\n2\n4\n";
+  ASSERT_TRUE(ImportMatrix("matrix_array.mtx", B));
+  EXPECT_EQ(B, (Matrix2d() << 1, 2, 3, 4).finished());
+
+  ofstream("matrix_coordinate.mtx") << "%%MatrixMarket matrix coordinate real symmetric\n3 3 4\n1 1 2\n2 1 -1\n2 2 2\n3 3 5\n";
+  ASSERT_TRUE(ImportMatrix("matrix_coordinate.mtx", B));
+  EXPECT_EQ(B, (Matrix3d() << 2, -1, 0, -1, 2, 0, 0, 0, 5).finished());
+
+  EXPECT_FALSE(ImportMatrix("missing.mtx", B));
+
+  ofstream("matrix_skew.mtx") << "%%MatrixMarket matrix coordinate real skew-symmetric\n2 2 1\n2 1 3\n";
+  EXPECT_FALSE(ImportMatrix("matrix_skew.mtx", B));
+
+  // a header promising more values than the file holds is rejected before allocating
+  {
+    ofstream file("matrix_truncated.bin", ios::binary);
+    const int64_t size[2] = {1 << 30, 1 << 30};
+    const double value = 1.0;
+    file.write(reinterpret_cast<const char*>(size), sizeof(size));
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+
+  EXPECT_FALSE(ImportMatrix("matrix_truncated.bin", B));
+
+  // the same for Matrix Market headers: a huge size with one entry, more entries than lines
+  ofstream("matrix_huge.mtx") << "%%MatrixMarket matrix coordinate real general\n100000 100000 1\n1 1 1\n";
+  EXPECT_FALSE(ImportMatrix("matrix_huge.mtx", B));
+
+  ofstream("matrix_count.mtx") << "%%MatrixMarket matrix coordinate real symmetric\n2 2 4294967295\n1 1 1\n";
+  EXPECT_FALSE(ImportMatrix("matrix_count.mtx", B));
+
+  unsigned int rows, cols;
+  vector<Triplet<double>> entries;
+  EXPECT_FALSE(ImportMatrixMarketEntries("matrix_count.mtx", rows, cols, entries));
+
+  ofstream("matrix_array_huge.mtx") << "%%MatrixMarket matrix array real general\n65536 65536\n1\n";
+  EXPECT_FALSE(ImportMatrix("matrix_array_huge.mtx", B));
+}
+
+#endif // __TEST_DENSESOLVER_H
@@ -0,0 +1,54 @@
+#ifndef __TEST_FIXEDSOLVER_H
+#define __TEST_FIXEDSOLVER_H
+
+#include <gtest/gtest.h>
+#include "fixedSolver.hpp"
+#include "linearSystem.hpp"
+
+using namespace testing;
+using namespace Eigen;
+using namespace LinearSystemLibrary;
+
+TEST(TestFixedSolver, TestSystem2)
+{
+  Matrix2d A;
+  A << 5.547001962252291e-01,-5.540607316466765e-01, 8.320502943378437e-01,-8.324762492991313e-01;
+  Vector2d b(-6.394645785530173e-04, 4.259549612877223e-04);
+  Vector2d solution(-1.0, -1.0);
+
+  double errRelPALU, errRelQR;
+  TestSolution(A, b, solution, errRelPALU, errRelQR);
+
+  EXPECT_LT(errRelPALU, 1e-12);
+  EXPECT_LT(errRelQR, 1e-12);
+}
+
+TEST(TestFixedSolver, TestSystem3)
+{
+  Matrix3d A;
+  A << 2.0, 1.0, -1.0,
+      -3.0, -1.0, 2.0,
+      -2.0, 1.0, 2.0;
+  Vector3d solution(2.0, 3.0, -1.0);
+  Vector3d b = A*solution;
+
+  EXPECT_LT((SolveSystemPALU(A, b) - solution).norm(), 1e-14);
+  EXPECT_LT((SolveSystemQR(A, b) - solution).norm(), 1e-14);
+}
+
+TEST(TestFixedSolver, TestSystem4AgainstDynamic)
+{
+  srand(1);
+  for(unsigned int t = 0; t < 100; t++)
+  {
+    Matrix4d A = Matrix4d::Random();
+    Vector4d b = Vector4d::Random();
+
+    const VectorXd reference = SolveSystemPALU(MatrixXd(A), VectorXd(b));
+
+    EXPECT_LT((SolveSystemPALU(A, b) - reference).norm(), 1e-10*reference.norm());
+    EXPECT_LT((SolveSystemQR(A, b) - reference).norm(), 1e-10*reference.norm());
+  }
+}
+
+#endif // __TEST_FIXEDSOLVER_H
@@ -0,0 +1,48 @@
+#ifndef __TEST_LEASTSQUARES_H
+#define __TEST_LEASTSQUARES_H
+
+#include <gtest/gtest.h>
+#include "leastSquares.hpp"
+
+using namespace testing;
+using namespace Eigen;
+using namespace LinearSystemLibrary;
+
+TEST(TestLeastSquares, TestAgainstColPivHouseholderQr)
+{
+  srand(10);
+  const MatrixXd A = MatrixXd::Random(5000, 10);
+  const VectorXd b = A*VectorXd::LinSpaced(10, 1.0, 10.0) + 0.1*VectorXd::Random(5000);
+
+  const VectorXd reference = A.colPivHouseholderQr().solve(b);
+  const double referenceResidual = (A*reference - b).norm();
+
+  for(unsigned int numThreads : {1u, 3u, 8u})
+    for(unsigned int blockRows : {7u, 512u, 100000u})
+    {
+      double residualNorm;
+      const VectorXd x = SolveLeastSquaresTSQR(A, b, residualNorm, numThreads, blockRows);
+
+      ASSERT_EQ(x.size(), 10);
+      EXPECT_LT((x - reference).norm(), 1e-10*reference.norm());
+      EXPECT_NEAR(residualNorm, referenceResidual, 1e-10*referenceResidual);
+    }
+}
+
+TEST(TestLeastSquares, TestSquareAndWrongSizes)
+{
+  srand(11);
+  const MatrixXd A = MatrixXd::Random(6, 6);
+  const VectorXd solution = VectorXd::Ones(6);
+
+  double residualNorm;
+  const VectorXd x = SolveLeastSquaresTSQR(A, A*solution, residualNorm, 4, 2);
+
+  EXPECT_LT((x - solution).norm(), 1e-12);
+  EXPECT_LT(residualNorm, 1e-12);
+
+  EXPECT_EQ(SolveLeastSquaresTSQR(MatrixXd::Random(3, 6), VectorXd::Ones(3), residualNorm).size(), 0);
+  EXPECT_EQ(SolveLeastSquaresTSQR(A, VectorXd::Ones(5), residualNorm).size(), 0);
+}
+
+#endif // __TEST_LEASTSQUARES_H
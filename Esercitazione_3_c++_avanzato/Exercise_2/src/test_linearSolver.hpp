@@ -0,0 +1,51 @@
+#ifndef __TEST_LINEARSOLVER_H
+#define __TEST_LINEARSOLVER_H
+
+#include <gtest/gtest.h>
+#include "linearSolver.hpp"
+#include "linearSystem.hpp"
+
+using namespace testing;
+using namespace Eigen;
+using namespace LinearSystemLibrary;
+
+TEST(TestLinearSolver, TestMultipleRightHandSides)
+{
+  srand(3);
+  const MatrixXd A = MatrixXd::Random(20, 20) + 20*MatrixXd::Identity(20, 20);
+  const MatrixXd B = MatrixXd::Random(20, 7);
+
+  LinearSolver solver(A);
+  const MatrixXd XPALU = solver.SolvePALU(B);
+  const MatrixXd XQR = solver.SolveQR(B);
+
+  for(unsigned int c = 0; c < B.cols(); c++)
+  {
+    const VectorXd x = SolveSystemPALU(A, B.col(c));
+    EXPECT_LT((XPALU.col(c) - x).norm(), 1e-12*x.norm());
+    EXPECT_LT((XQR.col(c) - x).norm(), 1e-12*x.norm());
+  }
+
+  solver.Compute(2*A);
+  EXPECT_LT((solver.SolvePALU(B) - 0.5*XPALU).norm(), 1e-12*XPALU.norm());
+}
+
+TEST(TestLinearSolver, TestSolutions)
+{
+  MatrixXd A(2, 2);
+  A << 5.547001962252291e-01,-5.540607316466765e-01, 8.320502943378437e-01,-8.324762492991313e-01;
+  MatrixXd solutions(2, 3);
+  solutions << -1.0, 1.0, 2.0,
+               -1.0, 2.0, 0.5;
+  const MatrixXd B = A*solutions;
+
+  VectorXd errRelPALU, errRelQR;
+  TestSolutions(A, B, solutions, errRelPALU, errRelQR);
+
+  ASSERT_EQ(errRelPALU.size(), 3);
+  ASSERT_EQ(errRelQR.size(), 3);
+  EXPECT_LT(errRelPALU.maxCoeff(), 1e-12);
+  EXPECT_LT(errRelQR.maxCoeff(), 1e-12);
+}
+
+#endif // __TEST_LINEARSOLVER_H
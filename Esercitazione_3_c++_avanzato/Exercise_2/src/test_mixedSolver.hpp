@@ -0,0 +1,52 @@
+#ifndef __TEST_MIXEDSOLVER_H
+#define __TEST_MIXEDSOLVER_H
+
+#include <gtest/gtest.h>
+#include "mixedSolver.hpp"
+
+using namespace testing;
+using namespace Eigen;
+using namespace LinearSystemLibrary;
+
+TEST(TestMixedSolver, TestDoubleAccuracy)
+{
+  srand(7);
+  const MatrixXd A = MatrixXd::Random(200, 200);
+  const VectorXd solution = VectorXd::Random(200);
+  const VectorXd b = A*solution;
+
+  MixedPrecisionInfo info;
+  const VectorXd x = SolveSystemMixedPrecision(A, b, info);
+
+  EXPECT_TRUE(info.Converged);
+  EXPECT_FALSE(info.DoubleFallback);
+  EXPECT_GT(info.Iterations, 0u);
+  EXPECT_LT((x - solution).norm()/solution.norm(), 1e-12);
+
+  const VectorXd xSingle = A.cast<float>().partialPivLu().solve(b.cast<float>()).cast<double>();
+  EXPECT_GT((xSingle - solution).norm()/solution.norm(), 1e-9);
+
+  double errRel;
+  unsigned int iterations;
+  TestSolutionMixedPrecision(A, b, solution, errRel, iterations);
+  EXPECT_LT(errRel, 1e-12);
+  EXPECT_EQ(iterations, info.Iterations);
+}
+
+TEST(TestMixedSolver, TestIllConditioned)
+{
+  MatrixXd A(2, 2);
+  A << 5.547001962252291e-01,-5.547001955851905e-01, 8.320502943378437e-01,-8.320502947645361e-01;
+  VectorXd b(2);
+  b << -6.400391328043042e-10, 4.266924591433963e-10;
+
+  MixedPrecisionInfo info;
+  const VectorXd x = SolveSystemMixedPrecision(A, b, info);
+
+  // the float refinement fails, the double fallback is as accurate as PALU
+  EXPECT_FALSE(info.Converged);
+  EXPECT_TRUE(info.DoubleFallback);
+  EXPECT_LT((x - VectorXd::Constant(2, -1.0)).norm()/sqrt(2.0), 1e-5);
+}
+
+#endif // __TEST_MIXEDSOLVER_H
@@ -0,0 +1,87 @@
+#ifndef __TEST_SPARSESOLVER_H
+#define __TEST_SPARSESOLVER_H
+
+#include <gtest/gtest.h>
+#include "sparseSolver.hpp"
+
+using namespace testing;
+using namespace Eigen;
+using namespace LinearSystemLibrary;
+
+/// \brief 2D Poisson matrix on a n x n grid, plus a non-symmetric convection term
+CsrMatrix TestPoissonMatrix(const int& n, const double& convection)
+{
+  vector<Triplet<double>> entries;
+
+  for(int i = 0; i < n; i++)
+    for(int j = 0; j < n; j++)
+    {
+      const int r = i*n + j;
+      entries.push_back(Triplet<double>(r, r, 4.0));
+
+      if(i > 0) entries.push_back(Triplet<double>(r, r - n, -1.0 - convection));
+      if(i < n - 1) entries.push_back(Triplet<double>(r, r + n, -1.0 + convection));
+      if(j > 0) entries.push_back(Triplet<double>(r, r - 1, -1.0));
+      if(j < n - 1) entries.push_back(Triplet<double>(r, r + 1, -1.0));
+    }
+
+  return CsrFromTriplets(n*n, n*n, entries);
+}
+
+TEST(TestSparseSolver, TestSymmetric)
+{
+  const CsrMatrix A = TestPoissonMatrix(20, 0.0);
+  const VectorXd solution = VectorXd::LinSpaced(400, -1.0, 1.0);
+  const VectorXd b = MapCsr(A)*solution;
+
+  ASSERT_EQ(A.RowOffsets.size(), 401u);
+
+  for(SparseMethod method : {SparseMethod::LU, SparseMethod::LDLT, SparseMethod::CG, SparseMethod::BiCGSTAB})
+    for(SparsePreconditioner preconditioner : {SparsePreconditioner::Diagonal, SparsePreconditioner::Incomplete})
+    {
+      SparseSolverInfo info;
+      const VectorXd x = SolveSystemSparse(A, b, method, info, preconditioner);
+
+      ASSERT_TRUE(info.Success);
+      EXPECT_LT((x - solution).norm()/solution.norm(), 1e-9);
+    }
+}
+
+TEST(TestSparseSolver, TestNonSymmetric)
+{
+  const CsrMatrix A = TestPoissonMatrix(20, 0.3);
+  const VectorXd solution = VectorXd::Ones(400);
+  const VectorXd b = MapCsr(A)*solution;
+
+  SparseSolverInfo info;
+  VectorXd x = SolveSystemSparse(A, b, SparseMethod::LU, info);
+  ASSERT_TRUE(info.Success);
+  EXPECT_LT((x - solution).norm()/solution.norm(), 1e-12);
+
+  x = SolveSystemSparse(A, b, SparseMethod::BiCGSTAB, info, SparsePreconditioner::Incomplete);
+  ASSERT_TRUE(info.Success);
+  EXPECT_GT(info.Iterations, 0u);
+  EXPECT_LT((x - solution).norm()/solution.norm(), 1e-9);
+
+  // the symmetric methods would solve the transpose
+  EXPECT_FALSE(IsSymmetric(A));
+  EXPECT_TRUE(IsSymmetric(TestPoissonMatrix(20, 0.0)));
+
+  for(SparseMethod method : {SparseMethod::LDLT, SparseMethod::CG})
+  {
+    x = SolveSystemSparse(A, b, method, info);
+    EXPECT_FALSE(info.Success);
+    EXPECT_EQ(x.size(), 0);
+  }
+
+  // same pattern, one value off the mirror
+  CsrMatrix B = TestPoissonMatrix(3, 0.0);
+  B.Values[1] = -2.0;
+  EXPECT_FALSE(IsSymmetric(B));
+
+  x = SolveSystemSparse(A, VectorXd::Ones(10), SparseMethod::LU, info);
+  EXPECT_FALSE(info.Success);
+  EXPECT_EQ(x.size(), 0);
+}
+
+#endif // __TEST_SPARSESOLVER_H
@@ -0,0 +1,72 @@
+#ifndef __TEST_STATICSOLVER_H
+#define __TEST_STATICSOLVER_H
+
+#include <gtest/gtest.h>
+#include "staticSolver.hpp"
+#include "Eigen/Eigen"
+
+using namespace testing;
+using namespace Eigen;
+using namespace LinearSystemLibrary;
+
+template<size_t N>
+void TestStaticAgainstEigen()
+{
+  for(unsigned int t = 0; t < 50; t++)
+  {
+    const Matrix<double, N, N> A = Matrix<double, N, N>::Random() + N*Matrix<double, N, N>::Identity();
+    const Matrix<double, N, 1> solution = Matrix<double, N, 1>::Random();
+    const Matrix<double, N, 1> b = A*solution;
+
+    StaticMatrix<N> staticA;
+    StaticVector<N> staticB;
+
+    for(size_t i = 0; i < N; i++)
+    {
+      staticB[i] = b(i);
+      for(size_t j = 0; j < N; j++)
+        staticA[i][j] = A(i, j);
+    }
+
+    const StaticVector<N> xPALU = SolveSystemPALU(staticA, staticB);
+    const StaticVector<N> xQR = SolveSystemQR(staticA, staticB);
+
+    for(size_t i = 0; i < N; i++)
+    {
+      EXPECT_NEAR(xPALU[i], solution(i), 1e-12);
+      EXPECT_NEAR(xQR[i], solution(i), 1e-12);
+    }
+  }
+}
+
+TEST(TestStaticSolver, TestSizes)
+{
+  srand(9);
+  TestStaticAgainstEigen<1>();
+  TestStaticAgainstEigen<2>();
+  TestStaticAgainstEigen<3>();
+  TestStaticAgainstEigen<5>();
+  TestStaticAgainstEigen<8>();
+}
+
+TEST(TestStaticSolver, TestStackFootprint)
+{
+  // the footprint covers every array the solvers work on, measured on the frames they use
+  const StaticInternal::PALUFrame<8> palu = {};
+  const StaticInternal::QRFrame<8> qr = {};
+
+  EXPECT_GE(StaticSolverStackBytes<8>(), sizeof(palu.LU) + sizeof(palu.y) + sizeof(palu.permutation) + sizeof(palu.z) + sizeof(palu.x));
+  EXPECT_GE(StaticSolverStackBytes<8>(), sizeof(qr.R) + sizeof(qr.y) + sizeof(qr.permutation) + sizeof(qr.v) + sizeof(qr.z) + sizeof(qr.x));
+
+  // independent lower bound of the QR: the matrix, the permutation and at least four vectors (b, Householder, z, x)
+  EXPECT_GE(StaticSolverStackBytes<8>(), sizeof(double[8][8]) + sizeof(size_t[8]) + 4*sizeof(double[8]));
+  EXPECT_LE(StaticSolverStackBytes<8>(), 1024u);
+
+  const StaticMatrix<2> singular = {{ {{1.0, 2.0}}, {{2.0, 4.0}} }};
+  const StaticVector<2> b = {{1.0, 2.0}};
+  const StaticVector<2> x = SolveSystemPALU(singular, b);
+
+  EXPECT_DOUBLE_EQ(singular[0][0]*x[0] + singular[0][1]*x[1], 1.0);
+}
+
+#endif // __TEST_STATICSOLVER_H
@@ -0,0 +1,18 @@
+#include "test_fixedSolver.hpp"
+#include "test_batchSolver.hpp"
+#include "test_linearSolver.hpp"
+#include "test_denseSolver.hpp"
+#include "test_sparseSolver.hpp"
+#include "test_adaptiveSolver.hpp"
+#include "test_mixedSolver.hpp"
+#include "test_batchValidation.hpp"
+#include "test_staticSolver.hpp"
+#include "test_leastSquares.hpp"
+
+#include <gtest/gtest.h>
+
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,134 @@
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "meshGenerators.hpp"
+#include "meshImport.hpp"
+#include "meshRenumbering.hpp"
+
+using namespace std;
+using namespace PolygonalLibrary;
+
+/// \brief The grid mesh of n x n squares with its vertices, edges and cells in random order
+PolygonalMesh ScrambledGrid(const unsigned int& n);
+
+/// \brief An assembly-like sweep over all the cells: each cell gathers the coordinates of its vertices
+/// and adds a value to its vertices and edges
+/// \return a checksum of the accumulated values
+double Sweep(const PolygonalMesh& mesh,
+             vector<double>& vertexValues,
+             vector<double>& edgeValues);
+
+/// \brief Time repeats sweeps on the mesh and print one row of the report
+/// \param renumberingSeconds: the time spent to renumber the mesh
+/// \param reference: the seconds of one sweep on the original mesh, 0 for the original mesh itself
+/// \return the seconds of one sweep
+double Measure(const string& method,
+               const PolygonalMesh& mesh,
+               const unsigned int& repeats,
+               const double& renumberingSeconds,
+               const double& reference);
+
+int main(int argc, char** argv)
+{
+  // polygonalMesh_benchmark [directory | grid size] [numThreads]
+  const string source = argc > 1 ? argv[1] : "1000";
+  const unsigned int numThreads = argc > 2 ? stoul(argv[2]) : 1;
+  const unsigned int repeats = 10;
+
+  PolygonalMesh mesh;
+
+  if(source.find_first_not_of("0123456789") == string::npos)
+    mesh = ScrambledGrid(stoul(source));
+  else if(!ImportMesh(mesh, source, numThreads))
+    return 1;
+
+  cout<< "method;cells;renumbering seconds;sweep seconds;speedup"<< endl;
+
+  const double reference = Measure("None", mesh, repeats, 0.0, 0.0);
+
+  for(const pair<string, RenumberingMethod>& method : {make_pair(string("ReverseCuthillMcKee"), RenumberingMethod::ReverseCuthillMcKee),
+                                                       make_pair(string("Morton"), RenumberingMethod::Morton),
+                                                       make_pair(string("Hilbert"), RenumberingMethod::Hilbert)})
+  {
+    PolygonalMesh renumbered = mesh;
+
+    const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    RenumberMesh(renumbered, method.second, numThreads);
+    const double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    Measure(method.first, renumbered, repeats, seconds, reference);
+  }
+
+  return 0;
+}
+
+PolygonalMesh ScrambledGrid(const unsigned int& n)
+{
+  PolygonalMesh mesh = GridMesh(n);
+  mt19937 generator(1);
+
+  auto randomPermutation = [&generator](const unsigned int& size)
+  {
+    vector<unsigned int> permutation(size);
+    iota(permutation.begin(), permutation.end(), 0);
+    shuffle(permutation.begin(), permutation.end(), generator);
+
+    return permutation;
+  };
+
+  MeshPermutation scramble;
+  scramble.Cell0Ds = randomPermutation(mesh.NumberCell0D);
+  scramble.Cell1Ds = randomPermutation(mesh.NumberCell1D);
+  scramble.Cell2Ds = randomPermutation(mesh.NumberCell2D);
+  RenumberMesh(mesh, scramble);
+
+  return mesh;
+}
+
+double Sweep(const PolygonalMesh& mesh,
+             vector<double>& vertexValues,
+             vector<double>& edgeValues)
+{
+  for(unsigned int c = 0; c < mesh.NumberCell2D; c++)
+  {
+    double value = 0.0;
+
+    for(const unsigned int* v = mesh.Cell2DVertices.Begin(c); v != mesh.Cell2DVertices.End(c); v++)
+      value += mesh.Cell0DCoordinates[*v].x()*mesh.Cell0DCoordinates[*v].y();
+
+    for(const unsigned int* v = mesh.Cell2DVertices.Begin(c); v != mesh.Cell2DVertices.End(c); v++)
+      vertexValues[*v] += value;
+
+    for(const unsigned int* e = mesh.Cell2DEdges.Begin(c); e != mesh.Cell2DEdges.End(c); e++)
+      edgeValues[*e] += value;
+  }
+
+  return accumulate(vertexValues.begin(), vertexValues.end(), 0.0) + accumulate(edgeValues.begin(), edgeValues.end(), 0.0);
+}
+
+double Measure(const string& method,
+               const PolygonalMesh& mesh,
+               const unsigned int& repeats,
+               const double& renumberingSeconds,
+               const double& reference)
+{
+  vector<double> vertexValues(mesh.NumberCell0D, 0.0), edgeValues(mesh.NumberCell1D, 0.0);
+  double checksum = Sweep(mesh, vertexValues, edgeValues);
+
+  const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+  for(unsigned int r = 0; r < repeats; r++)
+    checksum += Sweep(mesh, vertexValues, edgeValues);
+
+  const double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count()/repeats;
+
+  // the checksum keeps the sweeps alive
+  if(checksum == 0.123456789)
+    cerr<< checksum<< endl;
+
+  cout<< method<< ";"<< mesh.NumberCell2D<< ";"<< renumberingSeconds<< ";"<< seconds<< ";"<< (reference > 0.0 ? reference/seconds : 1.0)<< endl;
+
+  return seconds;
+}
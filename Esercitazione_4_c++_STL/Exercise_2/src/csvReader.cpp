@@ -0,0 +1,135 @@
+#include "csvReader.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+
+namespace PolygonalLibrary {
+
+    bool ReadFileBuffer(const string& filePath, string& buffer)
+    {
+        ifstream file(filePath, ios::binary);
+
+        if(file.fail())
+            return false;
+
+        file.seekg(0, ios::end);
+        const streamoff size = file.tellg();
+        file.seekg(0, ios::beg);
+
+        if(size < 0)
+            return false;
+
+        buffer.resize(size);
+
+        if(size > 0)
+            file.read(&buffer[0], size);
+
+        return !file.fail();
+    }
+// ***************************************************************************
+    unsigned int CountLines(const char* first, const char* last)
+    {
+        if(first == last)
+            return 0;
+
+        const unsigned int numNewLines = count(first, last, '\n');
+
+        return *(last - 1) == '\n' ? numNewLines : numNewLines + 1;
+    }
+// ***************************************************************************
+    const char* NextLine(const char* first, const char* last)
+    {
+        const char* newLine = find(first, last, '\n');
+
+        return newLine == last ? last : newLine + 1;
+    }
+// ***************************************************************************
+    bool EmptyLine(const char* it, const char* last)
+    {
+        return it == last || *it == '\n' || *it == '\r';
+    }
+// ***************************************************************************
+    unsigned int CountRows(const char* first, const char* last)
+    {
+        unsigned int numRows = 0;
+
+        for(const char* it = first; it != last; it = NextLine(it, last))
+            if(!EmptyLine(it, last))
+                numRows++;
+
+        return numRows;
+    }
+// ***************************************************************************
+    vector<const char*> SplitLines(const char* first, const char* last, const unsigned int& numRanges)
+    {
+        vector<const char*> bounds(numRanges + 1, last);
+        bounds[0] = first;
+
+        const size_t size = last - first;
+
+        for(unsigned int r = 1; r < numRanges; r++)
+        {
+            // move the cut to the next line start, never before the previous bound
+            const char* cut = max(first + size*r/numRanges, bounds[r - 1]);
+
+            bounds[r] = cut == first || *(cut - 1) == '\n' ? cut : NextLine(cut, last);
+        }
+
+        return bounds;
+    }
+// ***************************************************************************
+    /// \brief Check that a parsed field ends at a separator and move past it
+    bool EndField(const char*& it, const char* last)
+    {
+        if(it == last || *it == '\n' || *it == '\r')
+            return true;
+
+        if(*it != ';')
+            return false;
+
+        it++;
+
+        return true;
+    }
+// ***************************************************************************
+    bool ParseUnsigned(const char*& it, const char* last, unsigned int& value)
+    {
+        // ids are plain digit strings: an inline loop avoids the locale and errno handling of strtoul
+        if(it == last || *it < '0' || *it > '9')
+            return false;
+
+        unsigned long parsed = 0;
+
+        for(; it != last && *it >= '0' && *it <= '9'; it++)
+        {
+            parsed = 10*parsed + (*it - '0');
+
+            if(parsed > numeric_limits<unsigned int>::max())
+                return false;
+        }
+
+        value = parsed;
+
+        return EndField(it, last);
+    }
+// ***************************************************************************
+    bool ParseDouble(const char*& it, const char* last, double& value)
+    {
+        if(it == last || *it == ';' || *it == '\n' || *it == '\r' || *it == ' ' || *it == '\t')
+            return false;
+
+        char* end;
+        const double parsed = strtod(it, &end);
+
+        if(end == it || end > last)
+            return false;
+
+        value = parsed;
+        it = end;
+
+        return EndField(it, last);
+    }
+
+}
@@ -0,0 +1,49 @@
+#ifndef __CSVREADER_H
+#define __CSVREADER_H
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace PolygonalLibrary {
+
+  ///\brief Read a whole file into memory with a single buffered read
+  ///\param filePath: the path of the file
+  ///\param buffer: the content of the file
+  ///\return the result of the reading, true if is success, false otherwise
+  bool ReadFileBuffer(const string& filePath, string& buffer);
+
+  ///\brief Count the lines in [first, last), the last one can have no final '\n'
+  unsigned int CountLines(const char* first, const char* last);
+
+  ///\brief Check if the line starting at it has no fields
+  bool EmptyLine(const char* it, const char* last);
+
+  ///\brief Count the lines with at least one field in [first, last)
+  unsigned int CountRows(const char* first, const char* last);
+
+  ///\brief Split [first, last) in numRanges ranges of about the same size, each beginning at a line start
+  ///\return the numRanges + 1 bounds of the ranges, some ranges can be empty
+  vector<const char*> SplitLines(const char* first, const char* last, const unsigned int& numRanges);
+
+  ///\brief Return the beginning of the line after the one containing first, or last
+  const char* NextLine(const char* first, const char* last);
+
+  ///\brief Parse an unsigned field of a ';' separated line and move it past the separator
+  ///\param it: the beginning of the field, moved to the beginning of the next field
+  ///\param last: the end of the buffer
+  ///\param value: the parsed value
+  ///\return false if the field is missing or is not an unsigned integer
+  bool ParseUnsigned(const char*& it, const char* last, unsigned int& value);
+
+  ///\brief Parse a floating point field of a ';' separated line and move it past the separator
+  ///\param it: the beginning of the field, moved to the beginning of the next field
+  ///\param last: the end of the buffer
+  ///\param value: the parsed value
+  ///\return false if the field is missing or is not a number
+  bool ParseDouble(const char*& it, const char* last, double& value);
+
+}
+
+#endif // __CSVREADER_H
@@ -0,0 +1,191 @@
+#include "meshCache.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sys/stat.h>
+
+namespace PolygonalLibrary {
+
+    const char MeshCacheMagic[4] = {'P', 'M', 'S', 'H'};
+    const uint32_t MeshCacheEndianness = 0x01020304;
+
+    template<typename T>
+    void WriteValue(ofstream& file, const T& value)
+    {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    /// \brief Write the size of the array followed by its raw content
+    template<typename T, typename Allocator>
+    void WriteArray(ofstream& file, const vector<T, Allocator>& array)
+    {
+        WriteValue(file, static_cast<uint64_t>(array.size()));
+
+        if(!array.empty())
+            file.write(reinterpret_cast<const char*>(array.data()), array.size()*sizeof(T));
+    }
+
+    template<typename T>
+    bool ReadValue(ifstream& file, T& value)
+    {
+        return bool(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    /// \brief Read an array written by WriteArray
+    /// \param remaining: the bytes left in the file, to refuse the sizes of a corrupted file before allocating
+    template<typename T, typename Allocator>
+    bool ReadArray(ifstream& file, uint64_t& remaining, vector<T, Allocator>& array)
+    {
+        uint64_t size;
+
+        if(remaining < sizeof(size) || !ReadValue(file, size))
+            return false;
+
+        remaining -= sizeof(size);
+
+        if(size > remaining/sizeof(T))
+            return false;
+
+        array.resize(size);
+        remaining -= size*sizeof(T);
+
+        return size == 0 || bool(file.read(reinterpret_cast<char*>(array.data()), size*sizeof(T)));
+    }
+// ***************************************************************************
+    /// \brief Write a marker table as sorted keys, offsets and grouped ids
+    void WriteMarkers(ofstream& file, const MarkerTable& markers)
+    {
+        WriteArray(file, markers.Keys);
+        WriteArray(file, markers.Ids.Offsets);
+        WriteArray(file, markers.Ids.Indices);
+    }
+
+    /// \brief Check that the offsets of a CSR array are consistent with its indices
+    bool IsConsistent(const CsrArray& array, const unsigned int& numLists)
+    {
+        if(array.Offsets.size() != numLists + 1 || array.Offsets.front() != 0 || array.Offsets.back() != array.Indices.size())
+            return false;
+
+        for(unsigned int c = 0; c < numLists; c++)
+            if(array.Offsets[c] > array.Offsets[c + 1])
+                return false;
+
+        return true;
+    }
+
+    bool ReadMarkers(ifstream& file, uint64_t& remaining, MarkerTable& markers)
+    {
+        return ReadArray(file, remaining, markers.Keys) &&
+               ReadArray(file, remaining, markers.Ids.Offsets) &&
+               ReadArray(file, remaining, markers.Ids.Indices) &&
+               is_sorted(markers.Keys.begin(), markers.Keys.end()) &&
+               IsConsistent(markers.Ids, markers.Keys.size());
+    }
+// ***************************************************************************
+    bool ExportMeshCache(const PolygonalMesh& mesh, const string& filePath)
+    {
+        ofstream file(filePath, ios::binary);
+
+        if(file.fail())
+            return false;
+
+        file.write(MeshCacheMagic, sizeof(MeshCacheMagic));
+        WriteValue(file, static_cast<uint32_t>(MeshCacheVersion));
+        WriteValue(file, MeshCacheEndianness);
+
+        WriteArray(file, mesh.Cell0DId);
+        WriteArray(file, mesh.Cell0DCoordinates);
+        WriteMarkers(file, mesh.Cell0DMarkers);
+
+        WriteArray(file, mesh.Cell1DId);
+        WriteArray(file, mesh.Cell1DVertices);
+        WriteMarkers(file, mesh.Cell1DMarkers);
+
+        WriteArray(file, mesh.Cell2DId);
+        WriteArray(file, mesh.Cell2DMarker);
+        WriteArray(file, mesh.Cell2DVertices.Offsets);
+        WriteArray(file, mesh.Cell2DVertices.Indices);
+        WriteArray(file, mesh.Cell2DEdges.Offsets);
+        WriteArray(file, mesh.Cell2DEdges.Indices);
+
+        file.close();
+
+        return !file.fail();
+    }
+// ***************************************************************************
+    bool ImportMeshCache(PolygonalMesh& mesh, const string& filePath)
+    {
+        ifstream file(filePath, ios::binary | ios::ate);
+
+        if(file.fail())
+            return false;
+
+        uint64_t remaining = file.tellg();
+        file.seekg(0, ios::beg);
+
+        char magic[sizeof(MeshCacheMagic)];
+        uint32_t version, endianness;
+
+        if(remaining < sizeof(magic) + sizeof(version) + sizeof(endianness) ||
+           !file.read(magic, sizeof(magic)) || !ReadValue(file, version) || !ReadValue(file, endianness))
+            return false;
+
+        remaining -= sizeof(magic) + sizeof(version) + sizeof(endianness);
+
+        if(memcmp(magic, MeshCacheMagic, sizeof(magic)) != 0 || version != MeshCacheVersion || endianness != MeshCacheEndianness)
+            return false;
+
+        PolygonalMesh cached;
+
+        if(!ReadArray(file, remaining, cached.Cell0DId) ||
+           !ReadArray(file, remaining, cached.Cell0DCoordinates) ||
+           !ReadMarkers(file, remaining, cached.Cell0DMarkers) ||
+           !ReadArray(file, remaining, cached.Cell1DId) ||
+           !ReadArray(file, remaining, cached.Cell1DVertices) ||
+           !ReadMarkers(file, remaining, cached.Cell1DMarkers) ||
+           !ReadArray(file, remaining, cached.Cell2DId) ||
+           !ReadArray(file, remaining, cached.Cell2DMarker) ||
+           !ReadArray(file, remaining, cached.Cell2DVertices.Offsets) ||
+           !ReadArray(file, remaining, cached.Cell2DVertices.Indices) ||
+           !ReadArray(file, remaining, cached.Cell2DEdges.Offsets) ||
+           !ReadArray(file, remaining, cached.Cell2DEdges.Indices))
+            return false;
+
+        cached.NumberCell0D = cached.Cell0DId.size();
+        cached.NumberCell1D = cached.Cell1DId.size();
+        cached.NumberCell2D = cached.Cell2DId.size();
+
+        if(cached.Cell0DCoordinates.size() != cached.NumberCell0D ||
+           cached.Cell1DVertices.size() != cached.NumberCell1D ||
+           cached.Cell2DMarker.size() != cached.NumberCell2D ||
+           !IsConsistent(cached.Cell2DVertices, cached.NumberCell2D) ||
+           !IsConsistent(cached.Cell2DEdges, cached.NumberCell2D))
+            return false;
+
+        mesh = std::move(cached);
+
+        return true;
+    }
+// ***************************************************************************
+    bool IsCacheUpToDate(const string& cachePath, const vector<string>& sourcePaths)
+    {
+        struct stat cacheStatus;
+
+        if(stat(cachePath.c_str(), &cacheStatus) != 0)
+            return false;
+
+        for(const string& sourcePath : sourcePaths)
+        {
+            struct stat sourceStatus;
+
+            // a source modified in the same second as the cache may be newer: the cache is not trusted
+            if(stat(sourcePath.c_str(), &sourceStatus) == 0 && sourceStatus.st_mtime >= cacheStatus.st_mtime)
+                return false;
+        }
+
+        return true;
+    }
+
+}
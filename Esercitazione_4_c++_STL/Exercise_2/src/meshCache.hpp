@@ -0,0 +1,33 @@
+#ifndef __MESHCACHE_H
+#define __MESHCACHE_H
+
+#include <string>
+#include <vector>
+#include "polygonalMesh.hpp"
+
+namespace PolygonalLibrary {
+
+  /// \brief The version of the binary cache format, increase it whenever the layout changes
+  const unsigned int MeshCacheVersion = 1;
+
+  /// \brief The name of the cache written by ImportMesh next to the mesh files
+  const string MeshCacheFileName = "PolygonalMesh.cache";
+
+  ///\brief Export the mesh in a binary file: a header followed by the flat arrays of the mesh
+  ///\param mesh: a PolygonalMesh struct
+  ///\param filePath: the path of the cache file
+  ///\return the result of the writing, true if is success, false otherwise
+  bool ExportMeshCache(const PolygonalMesh& mesh, const string& filePath);
+
+  ///\brief Import a mesh written by ExportMeshCache
+  ///\param mesh: a PolygonalMesh struct
+  ///\param filePath: the path of the cache file
+  ///\return false if the file is missing, truncated, of another version or written on a machine of different endianness
+  bool ImportMeshCache(PolygonalMesh& mesh, const string& filePath);
+
+  ///\brief Check if the cache file exists and was modified after all the source files, the missing sources are ignored
+  bool IsCacheUpToDate(const string& cachePath, const std::vector<string>& sourcePaths);
+
+}
+
+#endif // __MESHCACHE_H
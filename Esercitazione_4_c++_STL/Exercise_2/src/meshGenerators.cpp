@@ -0,0 +1,72 @@
+#include "meshGenerators.hpp"
+#include "meshMarkers.hpp"
+
+namespace PolygonalLibrary {
+
+    PolygonalMesh GridMesh(const unsigned int& n)
+    {
+        PolygonalMesh mesh;
+        vector<unsigned int> vertexMarkers, edgeMarkers;
+
+        auto vertex = [&](const unsigned int& i, const unsigned int& j) { return j*(n + 1) + i; };
+
+        for(unsigned int j = 0; j <= n; j++)
+        {
+            for(unsigned int i = 0; i <= n; i++)
+            {
+                mesh.Cell0DId.push_back(vertex(i, j));
+                mesh.Cell0DCoordinates.push_back(Vector2d(double(i)/n, double(j)/n));
+                vertexMarkers.push_back(i == 0 || j == 0 || i == n || j == n ? 1 : 0);
+            }
+        }
+
+        // the horizontal edges first, then the vertical ones
+        auto horizontal = [&](const unsigned int& i, const unsigned int& j) { return j*n + i; };
+        auto vertical = [&](const unsigned int& i, const unsigned int& j) { return n*(n + 1) + j*(n + 1) + i; };
+
+        for(unsigned int j = 0; j <= n; j++)
+        {
+            for(unsigned int i = 0; i < n; i++)
+            {
+                mesh.Cell1DVertices.push_back(Vector2i(vertex(i, j), vertex(i + 1, j)));
+                edgeMarkers.push_back(j == 0 || j == n ? 1 : 0);
+            }
+        }
+
+        for(unsigned int j = 0; j < n; j++)
+        {
+            for(unsigned int i = 0; i <= n; i++)
+            {
+                mesh.Cell1DVertices.push_back(Vector2i(vertex(i, j), vertex(i, j + 1)));
+                edgeMarkers.push_back(i == 0 || i == n ? 1 : 0);
+            }
+        }
+
+        for(unsigned int e = 0; e < mesh.Cell1DVertices.size(); e++)
+            mesh.Cell1DId.push_back(e);
+
+        for(unsigned int j = 0; j < n; j++)
+        {
+            for(unsigned int i = 0; i < n; i++)
+            {
+                const unsigned int vertices[4] = {vertex(i, j), vertex(i + 1, j), vertex(i + 1, j + 1), vertex(i, j + 1)};
+                const unsigned int edges[4] = {horizontal(i, j), vertical(i + 1, j), horizontal(i, j + 1), vertical(i, j)};
+
+                mesh.Cell2DId.push_back(j*n + i);
+                mesh.Cell2DMarker.push_back(0);
+                mesh.Cell2DVertices.PushBack(vertices, vertices + 4);
+                mesh.Cell2DEdges.PushBack(edges, edges + 4);
+            }
+        }
+
+        mesh.NumberCell0D = mesh.Cell0DId.size();
+        mesh.NumberCell1D = mesh.Cell1DId.size();
+        mesh.NumberCell2D = mesh.Cell2DId.size();
+
+        BuildMarkerTable(vertexMarkers, mesh.Cell0DId, mesh.Cell0DMarkers);
+        BuildMarkerTable(edgeMarkers, mesh.Cell1DId, mesh.Cell1DMarkers);
+
+        return mesh;
+    }
+
+}
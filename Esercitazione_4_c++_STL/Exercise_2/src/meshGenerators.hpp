@@ -0,0 +1,16 @@
+#ifndef __MESHGENERATORS_H
+#define __MESHGENERATORS_H
+
+#include "polygonalMesh.hpp"
+
+namespace PolygonalLibrary {
+
+  ///\brief The unit square split in n x n counterclockwise squares, numbered by rows from the bottom left corner.
+  /// The boundary vertices and edges have marker 1
+  ///\param n: the number of squares on each side
+  ///\return the grid mesh, used by the benchmark and the tests
+  PolygonalMesh GridMesh(const unsigned int& n);
+
+}
+
+#endif // __MESHGENERATORS_H
@@ -0,0 +1,121 @@
+#include "meshGeometry.hpp"
+#include "parallel.hpp"
+
+#include <cmath>
+
+namespace PolygonalLibrary {
+
+    void ComputeGeometry(const PolygonalMesh& mesh, MeshGeometry& geometry, const unsigned int& numThreads)
+    {
+        // structure of arrays: the loops below read x and y as two contiguous streams
+        vector<double> x(mesh.NumberCell0D), y(mesh.NumberCell0D);
+
+        ParallelRanges(mesh.NumberCell0D, NumRanges(mesh.NumberCell0D, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int v = first; v < last; v++)
+            {
+                x[v] = mesh.Cell0DCoordinates[v](0);
+                y[v] = mesh.Cell0DCoordinates[v](1);
+            }
+        });
+
+        geometry.EdgeLengths.resize(mesh.NumberCell1D);
+
+        ParallelRanges(mesh.NumberCell1D, NumRanges(mesh.NumberCell1D, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int e = first; e < last; e++)
+            {
+                const double dx = x[mesh.Cell1DVertices[e][1]] - x[mesh.Cell1DVertices[e][0]];
+                const double dy = y[mesh.Cell1DVertices[e][1]] - y[mesh.Cell1DVertices[e][0]];
+
+                geometry.EdgeLengths[e] = sqrt(dx*dx + dy*dy);
+            }
+        });
+
+        geometry.CellAreas.resize(mesh.NumberCell2D);
+        geometry.CellCentroidsX.resize(mesh.NumberCell2D);
+        geometry.CellCentroidsY.resize(mesh.NumberCell2D);
+
+        ParallelRanges(mesh.NumberCell2D, NumRanges(mesh.NumberCell2D, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int c = first; c < last; c++)
+            {
+                const unsigned int* vertices = mesh.Cell2DVertices.Begin(c);
+                const unsigned int numVertices = mesh.Cell2DVertices.Size(c);
+
+                if(numVertices == 0)
+                {
+                    geometry.CellAreas[c] = geometry.CellCentroidsX[c] = geometry.CellCentroidsY[c] = 0.0;
+                    continue;
+                }
+
+                // the coordinates are taken relative to the first vertex to limit the cancellation in the cross products
+                const double x0 = x[vertices[0]], y0 = y[vertices[0]];
+                double area = 0.0, cx = 0.0, cy = 0.0, meanX = 0.0, meanY = 0.0;
+
+                for(unsigned int i = 0; i < numVertices; i++)
+                {
+                    const unsigned int next = i + 1 == numVertices ? 0 : i + 1;
+                    const double xi = x[vertices[i]] - x0, yi = y[vertices[i]] - y0;
+                    const double xj = x[vertices[next]] - x0, yj = y[vertices[next]] - y0;
+                    const double cross = xi*yj - xj*yi;
+
+                    area += cross;
+                    cx += (xi + xj)*cross;
+                    cy += (yi + yj)*cross;
+                    meanX += xi;
+                    meanY += yi;
+                }
+
+                area *= 0.5;
+                geometry.CellAreas[c] = area;
+
+                // a degenerate cell has no centroid: the mean of its vertices is used instead
+                if(area != 0.0)
+                {
+                    geometry.CellCentroidsX[c] = x0 + cx/(6.0*area);
+                    geometry.CellCentroidsY[c] = y0 + cy/(6.0*area);
+                }
+                else
+                {
+                    geometry.CellCentroidsX[c] = x0 + meanX/numVertices;
+                    geometry.CellCentroidsY[c] = y0 + meanY/numVertices;
+                }
+            }
+        });
+    }
+// ***************************************************************************
+    /// \brief Whether the geometry cached on the mesh can be used as is
+    bool GeometryCacheValid(const PolygonalMesh& mesh)
+    {
+        // the sizes catch the cells added or removed without an invalidation
+        return mesh.GeometryUpToDate &&
+               mesh.Geometry.CellAreas.size() == mesh.NumberCell2D &&
+               mesh.Geometry.EdgeLengths.size() == mesh.NumberCell1D;
+    }
+// ***************************************************************************
+    const MeshGeometry& UpdateGeometry(PolygonalMesh& mesh, const unsigned int& numThreads)
+    {
+        if(!GeometryCacheValid(mesh))
+        {
+            ComputeGeometry(mesh, mesh.Geometry, numThreads);
+            mesh.GeometryUpToDate = true;
+        }
+
+        return mesh.Geometry;
+    }
+// ***************************************************************************
+    const MeshGeometry& CachedGeometry(const PolygonalMesh& mesh, MeshGeometry& geometry, const unsigned int& numThreads)
+    {
+        if(GeometryCacheValid(mesh))
+            return mesh.Geometry;
+
+        ComputeGeometry(mesh, geometry, numThreads);
+
+        return geometry;
+    }
+
+}
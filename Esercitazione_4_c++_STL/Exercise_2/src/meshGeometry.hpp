@@ -0,0 +1,37 @@
+#ifndef __MESHGEOMETRY_H
+#define __MESHGEOMETRY_H
+
+#include "polygonalMesh.hpp"
+
+namespace PolygonalLibrary {
+
+  ///\brief Compute the areas (shoelace formula) and the centroids of all the Cell2Ds and the lengths of all the Cell1Ds
+  /// in one pass over the coordinates split in x and y arrays
+  ///\param mesh: a PolygonalMesh struct, whose ids are its positions
+  ///\param geometry: the resulting quantities
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  void ComputeGeometry(const PolygonalMesh& mesh, MeshGeometry& geometry, const unsigned int& numThreads = 1);
+
+  ///\brief Return the geometry cached on the mesh, computing it first if it is not up to date
+  ///\param mesh: a PolygonalMesh struct
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  const MeshGeometry& UpdateGeometry(PolygonalMesh& mesh, const unsigned int& numThreads = 1);
+
+  ///\brief Return the geometry cached on the mesh if it is up to date, otherwise compute it in geometry and return that:
+  /// the geometry of a const mesh, without recomputing the cache of the callers who keep it up to date
+  ///\param geometry: the storage for the computed geometry, left untouched when the cache is used
+  const MeshGeometry& CachedGeometry(const PolygonalMesh& mesh, MeshGeometry& geometry, const unsigned int& numThreads = 1);
+
+  ///\brief Mark the geometry cached on the mesh as out of date, to be called after changing the coordinates or the cells
+  inline void InvalidateGeometry(PolygonalMesh& mesh) { mesh.GeometryUpToDate = false; }
+
+  ///\brief Move the Cell0D with the given id, invalidating the cached geometry
+  inline void MoveCell0D(PolygonalMesh& mesh, const unsigned int& id, const Vector2d& coordinates)
+  {
+    mesh.Cell0DCoordinates[id] = coordinates;
+    InvalidateGeometry(mesh);
+  }
+
+}
+
+#endif // __MESHGEOMETRY_H
@@ -0,0 +1,343 @@
+#include "meshImport.hpp"
+#include "csvReader.hpp"
+#include "meshCache.hpp"
+#include "meshGeometry.hpp"
+#include "meshMarkers.hpp"
+#include "meshValidation.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <thread>
+
+namespace PolygonalLibrary {
+
+    /// \brief Print a marker table as key and ids
+    void PrintMarkers(const string& title, const MarkerTable& markers)
+    {
+        cout << title << endl;
+
+        for(unsigned int k = 0; k < markers.Size(); k++)
+        {
+            cout << "key:\t" << markers.Keys[k] << "\t values:";
+
+            for(const unsigned int* id = markers.Begin(k); id != markers.End(k); id++)
+                cout << "\t" << *id;
+
+            cout << endl;
+        }
+    }
+// ***************************************************************************
+    bool ImportMesh(PolygonalMesh& mesh, const string& directory, const unsigned int& numThreads, const bool& useCache)
+    {
+        const string cell0DsPath = directory + "/Cell0Ds.csv";
+        const string cell1DsPath = directory + "/Cell1Ds.csv";
+        const string cell2DsPath = directory + "/Cell2Ds.csv";
+        const string cachePath = directory + "/" + MeshCacheFileName;
+
+        const bool cached = useCache &&
+                            IsCacheUpToDate(cachePath, {cell0DsPath, cell1DsPath, cell2DsPath}) &&
+                            ImportMeshCache(mesh, cachePath);
+
+        bool importedCell0Ds = true, importedCell1Ds = true, importedCell2Ds = true;
+
+        InvalidateGeometry(mesh);
+
+        if(!cached && numThreads == 1)
+        {
+            importedCell0Ds = ImportCell0Ds(mesh, cell0DsPath);
+            importedCell1Ds = importedCell0Ds && ImportCell1Ds(mesh, cell1DsPath);
+            importedCell2Ds = importedCell1Ds && ImportCell2Ds(mesh, cell2DsPath);
+        }
+        else if(!cached)
+        {
+            // the three files fill disjoint fields of the mesh: they are read concurrently and joined before the check
+            thread cell0Ds([&](){ importedCell0Ds = ImportCell0Ds(mesh, cell0DsPath, numThreads); });
+            thread cell1Ds([&](){ importedCell1Ds = ImportCell1Ds(mesh, cell1DsPath, numThreads); });
+            importedCell2Ds = ImportCell2Ds(mesh, cell2DsPath, numThreads);
+
+            cell0Ds.join();
+            cell1Ds.join();
+        }
+
+        if(!importedCell0Ds)
+            return false;
+
+        PrintMarkers("Cell0D marker:", mesh.Cell0DMarkers);
+
+        if(!importedCell1Ds)
+            return false;
+
+        PrintMarkers("Cell1D marker:", mesh.Cell1DMarkers);
+
+        if(!importedCell2Ds)
+            return false;
+
+        // only correct meshes are cached
+        if(cached)
+            return true;
+
+        const vector<MeshDefect> defects = ValidateMesh(mesh, numThreads);
+
+        if(!defects.empty())
+        {
+            cerr << "Wrong mesh, " << defects.size() << " defects:" << endl;
+
+            for(const MeshDefect& defect : defects)
+                cerr << defect << endl;
+
+            return false;
+        }
+
+        // a cache that cannot be written only costs the next import a parse of the files
+        if(useCache)
+            ExportMeshCache(mesh, cachePath);
+
+        return true;
+    }
+// ***************************************************************************
+    /// \brief Parse the data lines of a mesh file, split in byte ranges parsed on separate threads
+    /// \param buffer: the content of the file
+    /// \param resize: resize(numRows, numRanges) is called once the rows are counted
+    /// \param parseRow: parseRow(it, last, row, range) parses the row number row, which belongs to range
+    /// \return the result of the parsing, true if is success, false otherwise
+    template<typename Resize, typename ParseRow>
+    bool ParseRows(const string& buffer,
+                   const string& filePath,
+                   const unsigned int& numThreads,
+                   const Resize& resize,
+                   const ParseRow& parseRow)
+    {
+        const char* last = buffer.c_str() + buffer.size();
+        const char* first = NextLine(buffer.c_str(), last);
+
+        // ranges smaller than 1 MB are not worth a thread
+        const size_t minRangeSize = 1 << 20;
+        const unsigned int numRanges = min<size_t>(NumThreads(numThreads), (last - first)/minRangeSize + 1);
+        const vector<const char*> bounds = SplitLines(first, last, numRanges);
+
+        vector<unsigned int> rowBegins(numRanges + 1, 0);
+
+        ParallelFor(numRanges, numThreads, [&](const unsigned int& r)
+        {
+            rowBegins[r + 1] = CountRows(bounds[r], bounds[r + 1]);
+        });
+
+        partial_sum(rowBegins.begin(), rowBegins.end(), rowBegins.begin());
+
+        resize(rowBegins[numRanges], numRanges);
+
+        const unsigned int noError = numeric_limits<unsigned int>::max();
+        vector<unsigned int> wrongRows(numRanges, noError);
+
+        ParallelFor(numRanges, numThreads, [&](const unsigned int& r)
+        {
+            unsigned int row = rowBegins[r];
+
+            for(const char* it = bounds[r]; it != bounds[r + 1]; it = NextLine(it, bounds[r + 1]))
+            {
+                if(EmptyLine(it, bounds[r + 1]))
+                    continue;
+
+                if(!parseRow(it, bounds[r + 1], row, r)){
+                    wrongRows[r] = row;
+                    return;
+                }
+
+                row++;
+            }
+        });
+
+        for(const unsigned int& row : wrongRows)
+        {
+            if(row != noError){
+                cerr << "Wrong row " << row << " of " << filePath << endl;
+                return false;
+            }
+        }
+
+        return true;
+    }
+// ***************************************************************************
+    bool ImportCell0Ds(PolygonalMesh& mesh, const string& filePath, const unsigned int& numThreads)
+    {
+        string buffer;
+
+        if(!ReadFileBuffer(filePath, buffer))
+            return false;
+
+        // new coordinates: the Cell1D and Cell2D imports leave the flag to ImportMesh, so that the three can run concurrently
+        InvalidateGeometry(mesh);
+
+        vector<unsigned int> markers;
+
+        auto resize = [&](const unsigned int& numRows, const unsigned int&)
+        {
+            mesh.NumberCell0D = numRows;
+            mesh.Cell0DId.resize(numRows);
+            mesh.Cell0DCoordinates.resize(numRows);
+            markers.resize(numRows);
+        };
+
+        auto parseRow = [&](const char*& it, const char* last, const unsigned int& c, const unsigned int&)
+        {
+            Vector2d& coord = mesh.Cell0DCoordinates[c];
+
+            return ParseUnsigned(it, last, mesh.Cell0DId[c]) &&
+                   ParseUnsigned(it, last, markers[c]) &&
+                   ParseDouble(it, last, coord(0)) &&
+                   ParseDouble(it, last, coord(1));
+        };
+
+        if(!ParseRows(buffer, filePath, numThreads, resize, parseRow))
+            return false;
+
+        if(mesh.NumberCell0D == 0){
+            cerr << "There is no cell 0D" << endl;
+            return false;
+        }
+
+        BuildMarkerTable(markers, mesh.Cell0DId, mesh.Cell0DMarkers);
+
+        return true;
+    }
+// ***************************************************************************
+    bool ImportCell1Ds(PolygonalMesh& mesh, const string& filePath, const unsigned int& numThreads)
+    {
+        string buffer;
+
+        if(!ReadFileBuffer(filePath, buffer))
+            return false;
+
+
+        vector<unsigned int> markers;
+
+        auto resize = [&](const unsigned int& numRows, const unsigned int&)
+        {
+            mesh.NumberCell1D = numRows;
+            mesh.Cell1DId.resize(numRows);
+            mesh.Cell1DVertices.resize(numRows);
+            markers.resize(numRows);
+        };
+
+        auto parseRow = [&](const char*& it, const char* last, const unsigned int& c, const unsigned int&)
+        {
+            unsigned int origin, end;
+
+            if(!ParseUnsigned(it, last, mesh.Cell1DId[c]) ||
+               !ParseUnsigned(it, last, markers[c]) ||
+               !ParseUnsigned(it, last, origin) ||
+               !ParseUnsigned(it, last, end))
+                return false;
+
+            mesh.Cell1DVertices[c] << origin, end;
+
+            return true;
+        };
+
+        if(!ParseRows(buffer, filePath, numThreads, resize, parseRow))
+            return false;
+
+        if(mesh.NumberCell1D == 0){
+            cerr << "There is no cell 1D" << endl;
+            return false;
+        }
+
+        BuildMarkerTable(markers, mesh.Cell1DId, mesh.Cell1DMarkers);
+
+        return true;
+    }
+// ***************************************************************************
+    /// \brief Parse a count followed by as many unsigned fields and append them as a new list
+    bool ParseList(const char*& it, const char* last, CsrArray& array)
+    {
+        unsigned int size;
+
+        if(!ParseUnsigned(it, last, size))
+            return false;
+
+        for(unsigned int i = 0; i < size; i++)
+        {
+            unsigned int index;
+
+            if(!ParseUnsigned(it, last, index))
+                return false;
+
+            array.Indices.push_back(index);
+        }
+
+        array.Offsets.push_back(array.Indices.size());
+
+        return true;
+    }
+// ***************************************************************************
+    /// \brief Concatenate the lists parsed by each range in array, in parallel
+    void JoinRanges(const vector<CsrArray>& ranges, const unsigned int& numThreads, CsrArray& array)
+    {
+        vector<unsigned int> listBegins(ranges.size() + 1, 0);
+        vector<unsigned int> indexBegins(ranges.size() + 1, 0);
+
+        for(unsigned int r = 0; r < ranges.size(); r++)
+        {
+            listBegins[r + 1] = listBegins[r] + ranges[r].Size();
+            indexBegins[r + 1] = indexBegins[r] + ranges[r].Indices.size();
+        }
+
+        array.Offsets.resize(listBegins.back() + 1);
+        array.Indices.resize(indexBegins.back());
+        array.Offsets[0] = 0;
+
+        ParallelFor(ranges.size(), numThreads, [&](const unsigned int& r)
+        {
+            for(unsigned int c = 0; c < ranges[r].Size(); c++)
+                array.Offsets[listBegins[r] + c + 1] = indexBegins[r] + ranges[r].Offsets[c + 1];
+
+            copy(ranges[r].Indices.begin(), ranges[r].Indices.end(), array.Indices.begin() + indexBegins[r]);
+        });
+    }
+// ***************************************************************************
+    bool ImportCell2Ds(PolygonalMesh& mesh, const string& filePath, const unsigned int& numThreads)
+    {
+        string buffer;
+
+        if(!ReadFileBuffer(filePath, buffer))
+            return false;
+
+
+        // the lists have different lengths: each range fills its own CSR arrays, joined at the end
+        vector<CsrArray> vertices, edges;
+
+        auto resize = [&](const unsigned int& numRows, const unsigned int& numRanges)
+        {
+            mesh.NumberCell2D = numRows;
+            mesh.Cell2DId.resize(numRows);
+            mesh.Cell2DMarker.resize(numRows);
+            vertices.resize(numRanges);
+            edges.resize(numRanges);
+        };
+
+        auto parseRow = [&](const char*& it, const char* last, const unsigned int& c, const unsigned int& r)
+        {
+            return ParseUnsigned(it, last, mesh.Cell2DId[c]) &&
+                   ParseUnsigned(it, last, mesh.Cell2DMarker[c]) &&
+                   ParseList(it, last, vertices[r]) &&
+                   ParseList(it, last, edges[r]);
+        };
+
+        if(!ParseRows(buffer, filePath, numThreads, resize, parseRow))
+            return false;
+
+        if(mesh.NumberCell2D == 0){
+            cerr << "There is no cell 2D" << endl;
+            return false;
+        }
+
+        JoinRanges(vertices, numThreads, mesh.Cell2DVertices);
+        JoinRanges(edges, numThreads, mesh.Cell2DEdges);
+
+        return true;
+    }
+
+}
@@ -0,0 +1,42 @@
+#ifndef __MESHIMPORT_H
+#define __MESHIMPORT_H
+
+#include <string>
+#include "polygonalMesh.hpp"
+
+namespace PolygonalLibrary {
+
+  ///\brief Import the Polygonal mesh and test if the mesh is correct, printing all its defects.
+  /// The mesh is read from the binary cache when it is newer than the files, otherwise the cache is written after the check
+  ///\param mesh: a PolygonalMesh struct
+  ///\param directory: the folder containing Cell0Ds.csv, Cell1Ds.csv and Cell2Ds.csv
+  ///\param numThreads: the threads of each file import and of the check, if it is not 1 the three files are read concurrently,
+  /// 0 means all the hardware threads
+  ///\param useCache: false to always read the files and never write the cache
+  ///\return the result of the reading, true if is success, false otherwise
+  bool ImportMesh(PolygonalMesh& mesh, const string& directory = ".", const unsigned int& numThreads = 1, const bool& useCache = true);
+
+  ///\brief Import the Cell0D properties from Cell0Ds.csv file
+  ///\param mesh: a PolygonalMesh struct
+  ///\param filePath: the path of the file, read with one buffered pass
+  ///\param numThreads: the number of byte ranges of the file parsed in parallel, 0 means all the hardware threads
+  ///\return the result of the reading, true if is success, false otherwise
+  bool ImportCell0Ds(PolygonalMesh& mesh, const string& filePath = "./Cell0Ds.csv", const unsigned int& numThreads = 1);
+
+  ///\brief Import the Cell1D properties from Cell1Ds.csv file
+  ///\param mesh: a PolygonalMesh struct
+  ///\param filePath: the path of the file, read with one buffered pass
+  ///\param numThreads: the number of byte ranges of the file parsed in parallel, 0 means all the hardware threads
+  ///\return the result of the reading, true if is success, false otherwise
+  bool ImportCell1Ds(PolygonalMesh& mesh, const string& filePath = "./Cell1Ds.csv", const unsigned int& numThreads = 1);
+
+  ///\brief Import the Cell2D properties from Cell2Ds.csv file
+  ///\param mesh: a PolygonalMesh struct
+  ///\param filePath: the path of the file, read with one buffered pass
+  ///\param numThreads: the number of byte ranges of the file parsed in parallel, 0 means all the hardware threads
+  ///\return the result of the reading, true if is success, false otherwise
+  bool ImportCell2Ds(PolygonalMesh& mesh, const string& filePath = "./Cell2Ds.csv", const unsigned int& numThreads = 1);
+
+}
+
+#endif // __MESHIMPORT_H
@@ -0,0 +1,81 @@
+#include "meshMarkers.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace PolygonalLibrary {
+
+    void BuildMarkerTable(const vector<unsigned int>& markers,
+                          const vector<unsigned int>& ids,
+                          MarkerTable& table)
+    {
+        table.Keys.clear();
+        table.Ids = CsrArray();
+
+        const unsigned int numCells = markers.size();
+        const unsigned int maxMarker = numCells == 0 ? 0 : *max_element(markers.begin(), markers.end());
+
+        if(maxMarker > 2*numCells + 1024)
+        {
+            // sparse markers: a stable sort of the (marker, position) pairs groups them in the same order
+            vector<pair<unsigned int, unsigned int>> pairs;
+
+            for(unsigned int c = 0; c < numCells; c++)
+                if(markers[c] != 0)
+                    pairs.push_back({markers[c], c});
+
+            stable_sort(pairs.begin(), pairs.end(), [](const pair<unsigned int, unsigned int>& a, const pair<unsigned int, unsigned int>& b)
+            {
+                return a.first < b.first;
+            });
+
+            table.Ids.Indices.resize(pairs.size());
+
+            for(unsigned int i = 0; i < pairs.size(); i++)
+            {
+                if(table.Keys.empty() || table.Keys.back() != pairs[i].first)
+                {
+                    if(!table.Keys.empty())
+                        table.Ids.Offsets.push_back(i);
+
+                    table.Keys.push_back(pairs[i].first);
+                }
+
+                table.Ids.Indices[i] = ids[pairs[i].second];
+            }
+
+            if(!table.Keys.empty())
+                table.Ids.Offsets.push_back(pairs.size());
+
+            return;
+        }
+
+        // counting sort: count the cells of each marker, then place each id at the next free slot of its marker
+        vector<unsigned int> counts(maxMarker + 1, 0);
+
+        for(const unsigned int& marker : markers)
+            counts[marker]++;
+
+        counts[0] = 0;
+
+        vector<unsigned int> slots(maxMarker + 1, 0);
+        table.Ids.Offsets.reserve(maxMarker + 1);
+
+        for(unsigned int marker = 1; marker <= maxMarker; marker++)
+        {
+            if(counts[marker] == 0)
+                continue;
+
+            slots[marker] = table.Ids.Offsets.back();
+            table.Keys.push_back(marker);
+            table.Ids.Offsets.push_back(table.Ids.Offsets.back() + counts[marker]);
+        }
+
+        table.Ids.Indices.resize(table.Ids.Offsets.back());
+
+        for(unsigned int c = 0; c < numCells; c++)
+            if(markers[c] != 0)
+                table.Ids.Indices[slots[markers[c]]++] = ids[c];
+    }
+
+}
@@ -0,0 +1,19 @@
+#ifndef __MESHMARKERS_H
+#define __MESHMARKERS_H
+
+#include <vector>
+#include "polygonalMesh.hpp"
+
+namespace PolygonalLibrary {
+
+  ///\brief Group the ids by marker with a counting sort, the marker 0 marks the internal cells and is not stored
+  ///\param markers: the marker of each cell
+  ///\param ids: the id of each cell
+  ///\param table: the resulting MarkerTable, the ids of each marker keep the order of the cells
+  void BuildMarkerTable(const std::vector<unsigned int>& markers,
+                        const std::vector<unsigned int>& ids,
+                        MarkerTable& table);
+
+}
+
+#endif // __MESHMARKERS_H
@@ -0,0 +1,229 @@
+#include "meshPartition.hpp"
+#include "meshGeometry.hpp"
+#include "meshTopology.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+namespace PolygonalLibrary {
+
+    /// \brief Group the items by key in a CSR array with numKeys lists, each list sorted by increasing item
+    void GroupByKey(const vector<unsigned int>& keys, const unsigned int& numKeys, CsrArray& groups)
+    {
+        groups.Offsets.assign(numKeys + 1, 0);
+
+        for(const unsigned int& key : keys)
+            groups.Offsets[key + 1]++;
+
+        partial_sum(groups.Offsets.begin(), groups.Offsets.end(), groups.Offsets.begin());
+
+        vector<unsigned int> next(groups.Offsets.begin(), groups.Offsets.end() - 1);
+        groups.Indices.resize(keys.size());
+
+        for(unsigned int i = 0; i < keys.size(); i++)
+            groups.Indices[next[keys[i]]++] = i;
+    }
+// ***************************************************************************
+    /// \brief The parts of the Cell2Ds by recursive coordinate bisection of their centroids
+    vector<unsigned int> CoordinateBisection(const PolygonalMesh& mesh, const unsigned int& numParts, const unsigned int& numThreads)
+    {
+        MeshGeometry computed;
+        const MeshGeometry& geometry = CachedGeometry(mesh, computed, numThreads);
+
+        const vector<double>* centroids[2] = {&geometry.CellCentroidsX, &geometry.CellCentroidsY};
+
+        // the cells [First, Last) of order go to the parts [FirstPart, FirstPart + NumParts)
+        struct Segment
+        {
+            unsigned int First;
+            unsigned int Last;
+            unsigned int FirstPart;
+            unsigned int NumParts;
+        };
+
+        vector<unsigned int> order(mesh.NumberCell2D);
+        iota(order.begin(), order.end(), 0);
+
+        vector<unsigned int> parts(mesh.NumberCell2D);
+        vector<Segment> segments = {{0, mesh.NumberCell2D, 0, numParts}};
+
+        // the segments of a level are disjoint: they are cut in parallel
+        while(!segments.empty())
+        {
+            vector<Segment> halves(2*segments.size());
+
+            ParallelFor(segments.size(), numThreads, [&](const unsigned int& s)
+            {
+                const Segment& segment = segments[s];
+
+                if(segment.NumParts == 1)
+                {
+                    for(unsigned int i = segment.First; i < segment.Last; i++)
+                        parts[order[i]] = segment.FirstPart;
+
+                    halves[2*s].NumParts = halves[2*s + 1].NumParts = 0;
+                    return;
+                }
+
+                double lower[2] = {numeric_limits<double>::max(), numeric_limits<double>::max()};
+                double upper[2] = {-numeric_limits<double>::max(), -numeric_limits<double>::max()};
+
+                for(unsigned int i = segment.First; i < segment.Last; i++)
+                {
+                    for(unsigned int d = 0; d < 2; d++)
+                    {
+                        lower[d] = min(lower[d], (*centroids[d])[order[i]]);
+                        upper[d] = max(upper[d], (*centroids[d])[order[i]]);
+                    }
+                }
+
+                const vector<double>& axis = *centroids[upper[0] - lower[0] >= upper[1] - lower[1] ? 0 : 1];
+                const unsigned int leftParts = segment.NumParts/2;
+                const unsigned int middle = segment.First +
+                                            static_cast<unsigned long long>(segment.Last - segment.First)*leftParts/segment.NumParts;
+
+                // ties are broken by id, so that the partition does not depend on the threads
+                nth_element(order.begin() + segment.First, order.begin() + middle, order.begin() + segment.Last,
+                            [&axis](const unsigned int& a, const unsigned int& b)
+                {
+                    return axis[a] != axis[b] ? axis[a] < axis[b] : a < b;
+                });
+
+                halves[2*s] = {segment.First, middle, segment.FirstPart, leftParts};
+                halves[2*s + 1] = {middle, segment.Last, segment.FirstPart + leftParts, segment.NumParts - leftParts};
+            });
+
+            segments.clear();
+
+            for(const Segment& half : halves)
+                if(half.NumParts > 0)
+                    segments.push_back(half);
+        }
+
+        return parts;
+    }
+// ***************************************************************************
+    MeshPartition PartitionMesh(const PolygonalMesh& mesh, const unsigned int& numParts, const unsigned int& numThreads)
+    {
+        MeshPartition partition;
+
+        // no parts to bisect the cells in: the empty partition
+        if(numParts == 0)
+            return partition;
+
+        partition.CellParts = CoordinateBisection(mesh, numParts, numThreads);
+
+        const vector<unsigned int>& parts = partition.CellParts;
+        CsrArray vertexCells;
+        TransposeCsr(mesh.Cell2DVertices, mesh.NumberCell0D, numThreads, vertexCells);
+
+        // a cell is on the interface if one of its vertices belongs to a cell of another part
+        vector<unsigned int> interface(mesh.NumberCell2D, 0);
+
+        ParallelRanges(mesh.NumberCell2D, NumRanges(mesh.NumberCell2D, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int c = first; c < last; c++)
+                for(const unsigned int* v = mesh.Cell2DVertices.Begin(c); v != mesh.Cell2DVertices.End(c) && !interface[c]; v++)
+                    for(const unsigned int* d = vertexCells.Begin(*v); d != vertexCells.End(*v); d++)
+                        if(parts[*d] != parts[c])
+                            interface[c] = 1;
+        });
+
+        // the interior cells of part p have key 2p, the interface ones 2p + 1
+        vector<unsigned int> keys(mesh.NumberCell2D);
+
+        for(unsigned int c = 0; c < mesh.NumberCell2D; c++)
+            keys[c] = 2*parts[c] + interface[c];
+
+        CsrArray groups;
+        GroupByKey(keys, 2*numParts, groups);
+
+        for(unsigned int p = 0; p < numParts; p++)
+        {
+            partition.InteriorCells.PushBack(groups.Begin(2*p), groups.End(2*p));
+            partition.InterfaceCells.PushBack(groups.Begin(2*p + 1), groups.End(2*p + 1));
+        }
+
+        // the halo of a part: the cells of the other parts around its interface cells
+        vector<pair<unsigned int, unsigned int>> halo;
+
+        ParallelCollect(partition.InterfaceCells.Indices.size(), numThreads,
+                        [&](const unsigned int& first, const unsigned int& last, vector<pair<unsigned int, unsigned int>>& chunk)
+        {
+            for(unsigned int i = first; i < last; i++)
+            {
+                const unsigned int c = partition.InterfaceCells.Indices[i];
+
+                for(const unsigned int* v = mesh.Cell2DVertices.Begin(c); v != mesh.Cell2DVertices.End(c); v++)
+                    for(const unsigned int* d = vertexCells.Begin(*v); d != vertexCells.End(*v); d++)
+                        if(parts[*d] != parts[c])
+                            chunk.push_back({parts[c], *d});
+            }
+        }, halo);
+
+        sort(halo.begin(), halo.end());
+        halo.erase(unique(halo.begin(), halo.end()), halo.end());
+
+        partition.HaloCells.Offsets.assign(numParts + 1, 0);
+        partition.HaloCells.Indices.resize(halo.size());
+
+        for(unsigned int i = 0; i < halo.size(); i++)
+        {
+            partition.HaloCells.Offsets[halo[i].first + 1]++;
+            partition.HaloCells.Indices[i] = halo[i].second;
+        }
+
+        partial_sum(partition.HaloCells.Offsets.begin(), partition.HaloCells.Offsets.end(), partition.HaloCells.Offsets.begin());
+
+        return partition;
+    }
+// ***************************************************************************
+    MeshPartition PartitionMesh(PolygonalMesh& mesh, const unsigned int& numParts, const unsigned int& numThreads)
+    {
+        UpdateGeometry(mesh, numThreads);
+
+        return PartitionMesh(static_cast<const PolygonalMesh&>(mesh), numParts, numThreads);
+    }
+// ***************************************************************************
+    MeshColouring ColourMesh(const PolygonalMesh& mesh, const unsigned int& numThreads)
+    {
+        CsrArray vertexCells;
+        TransposeCsr(mesh.Cell2DVertices, mesh.NumberCell0D, numThreads, vertexCells);
+
+        const unsigned int uncoloured = numeric_limits<unsigned int>::max();
+        MeshColouring colouring;
+        colouring.CellColours.assign(mesh.NumberCell2D, uncoloured);
+
+        // taken[k] == c marks the colour k as used around the cell c
+        vector<unsigned int> taken;
+        unsigned int numColours = 0;
+
+        for(unsigned int c = 0; c < mesh.NumberCell2D; c++)
+        {
+            for(const unsigned int* v = mesh.Cell2DVertices.Begin(c); v != mesh.Cell2DVertices.End(c); v++)
+                for(const unsigned int* d = vertexCells.Begin(*v); d != vertexCells.End(*v); d++)
+                    if(colouring.CellColours[*d] != uncoloured)
+                        taken[colouring.CellColours[*d]] = c;
+
+            unsigned int colour = 0;
+
+            while(colour < numColours && taken[colour] == c)
+                colour++;
+
+            if(colour == numColours){
+                numColours++;
+                taken.push_back(uncoloured);
+            }
+
+            colouring.CellColours[c] = colour;
+        }
+
+        GroupByKey(colouring.CellColours, numColours, colouring.ColourCells);
+
+        return colouring;
+    }
+
+}
@@ -0,0 +1,88 @@
+#ifndef __MESHPARTITION_H
+#define __MESHPARTITION_H
+
+#include <vector>
+#include "parallel.hpp"
+#include "polygonalMesh.hpp"
+
+namespace PolygonalLibrary {
+
+  /// \brief The Cell2Ds split in parts, each list of the CSR arrays is a part and is sorted by increasing id
+  struct MeshPartition
+  {
+    std::vector<unsigned int> CellParts; ///< the part of each Cell2D
+    CsrArray InteriorCells; ///< the Cell2Ds whose vertices belong only to Cell2Ds of the same part
+    CsrArray InterfaceCells; ///< the Cell2Ds sharing a vertex with a Cell2D of another part
+    CsrArray HaloCells; ///< the Cell2Ds of the other parts sharing a vertex with the part
+
+    /// \brief the number of parts
+    unsigned int NumParts() const { return InteriorCells.Size(); }
+  };
+
+  /// \brief The Cell2Ds split in colours: two Cell2Ds of the same colour have no common vertex
+  struct MeshColouring
+  {
+    std::vector<unsigned int> CellColours; ///< the colour of each Cell2D
+    CsrArray ColourCells; ///< the Cell2Ds of each colour, sorted by increasing id
+
+    /// \brief the number of colours
+    unsigned int NumColours() const { return ColourCells.Size(); }
+  };
+
+  ///\brief Split the Cell2Ds in numParts parts by recursive coordinate bisection of their centroids:
+  /// each cut halves the longer side of the bounding box of the centroids, in proportion to the parts on each side,
+  /// so that the sizes of the parts differ by a few cells at most
+  ///\param mesh: a PolygonalMesh struct, whose ids are its positions and whose connectivity is valid (see ValidateMesh)
+  ///\param numParts: the number of parts, 0 gives an empty partition without parts
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  /// The centroids come from the geometry cached on the mesh when it is up to date (see CachedGeometry)
+  MeshPartition PartitionMesh(const PolygonalMesh& mesh, const unsigned int& numParts, const unsigned int& numThreads = 1);
+
+  ///\brief PartitionMesh, bringing the geometry cached on the mesh up to date first (see UpdateGeometry)
+  MeshPartition PartitionMesh(PolygonalMesh& mesh, const unsigned int& numParts, const unsigned int& numThreads = 1);
+
+  ///\brief Colour the Cell2Ds greedily in order of id: each Cell2D takes the smallest colour
+  /// not taken by a Cell2D sharing one of its vertices
+  ///\param mesh: a PolygonalMesh struct, whose ids are its positions and whose connectivity is valid (see ValidateMesh)
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  MeshColouring ColourMesh(const PolygonalMesh& mesh, const unsigned int& numThreads = 1);
+
+  ///\brief Call task(c) for every Cell2D c without two concurrent calls on Cell2Ds with a common vertex or edge:
+  /// the interior Cell2Ds of the parts run in parallel, one part per task, then the interface Cell2Ds run on the calling thread
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  template<typename Task>
+  void PartitionedCellLoop(const MeshPartition& partition, const unsigned int& numThreads, const Task& task)
+  {
+    ParallelFor(partition.NumParts(), numThreads, [&](const unsigned int& p)
+    {
+      for(const unsigned int* c = partition.InteriorCells.Begin(p); c != partition.InteriorCells.End(p); c++)
+        task(*c);
+    });
+
+    for(const unsigned int& c : partition.InterfaceCells.Indices)
+      task(c);
+  }
+
+  ///\brief Call task(c) for every Cell2D c without two concurrent calls on Cell2Ds with a common vertex or edge:
+  /// the colours run one after the other, the Cell2Ds of a colour in parallel
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  template<typename Task>
+  void ColouredCellLoop(const MeshColouring& colouring, const unsigned int& numThreads, const Task& task)
+  {
+    for(unsigned int k = 0; k < colouring.NumColours(); k++)
+    {
+      const unsigned int* cells = colouring.ColourCells.Begin(k);
+      const unsigned int numCells = colouring.ColourCells.Size(k);
+
+      ParallelRanges(numCells, NumRanges(numCells, numThreads), numThreads,
+                     [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+      {
+        for(unsigned int i = first; i < last; i++)
+          task(cells[i]);
+      });
+    }
+  }
+
+}
+
+#endif // __MESHPARTITION_H
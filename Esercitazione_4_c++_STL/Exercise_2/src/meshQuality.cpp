@@ -0,0 +1,263 @@
+#include "meshQuality.hpp"
+#include "meshGeometry.hpp"
+#include "meshTopology.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <utility>
+
+namespace PolygonalLibrary {
+
+    /// \brief Check the areas, the orientation and the convexity of the cells
+    void CheckCells(const PolygonalMesh& mesh,
+                    const MeshGeometry& geometry,
+                    const double& tolerance,
+                    const unsigned int& numThreads,
+                    vector<QualityIssue>& issues)
+    {
+        ParallelCollect(mesh.NumberCell2D, numThreads, [&](const unsigned int& first, const unsigned int& last, vector<QualityIssue>& chunk)
+        {
+            for(unsigned int c = first; c < last; c++)
+            {
+                const unsigned int* vertices = mesh.Cell2DVertices.Begin(c);
+                const unsigned int numVertices = mesh.Cell2DVertices.Size(c);
+                double perimeter = 0.0;
+
+                for(unsigned int i = 0; i < numVertices; i++)
+                    perimeter += (mesh.Cell0DCoordinates[vertices[(i + 1) % numVertices]] - mesh.Cell0DCoordinates[vertices[i]]).norm();
+
+                const double area = geometry.CellAreas[c];
+
+                if(abs(area) <= tolerance*perimeter*perimeter){
+                    chunk.push_back({QualityIssueType::ZeroAreaCell, c, 0, area});
+                    continue;
+                }
+
+                if(area < 0.0)
+                    chunk.push_back({QualityIssueType::NegativeAreaCell, c, 0, area});
+
+                // a reflex vertex turns against the orientation of the cell, collinear vertices are allowed
+                for(unsigned int i = 0; i < numVertices; i++)
+                {
+                    const Vector2d& previous = mesh.Cell0DCoordinates[vertices[(i + numVertices - 1) % numVertices]];
+                    const Vector2d& current = mesh.Cell0DCoordinates[vertices[i]];
+                    const Vector2d& next = mesh.Cell0DCoordinates[vertices[(i + 1) % numVertices]];
+                    const Vector2d a = current - previous, b = next - current;
+                    const double turn = a(0)*b(1) - a(1)*b(0);
+
+                    if((area > 0.0 ? turn : -turn) < -tolerance*a.norm()*b.norm()){
+                        chunk.push_back({QualityIssueType::NonConvexCell, c, vertices[i], turn});
+                        break;
+                    }
+                }
+            }
+        }, issues);
+    }
+// ***************************************************************************
+    /// \brief Check if the edge e runs from its origin to its end when the cell c is visited in the order of its vertices
+    bool IsForward(const PolygonalMesh& mesh, const unsigned int& c, const unsigned int& e)
+    {
+        const unsigned int* vertices = mesh.Cell2DVertices.Begin(c);
+        const unsigned int numVertices = mesh.Cell2DVertices.Size(c);
+        const unsigned int origin = mesh.Cell1DVertices[e][0];
+        const unsigned int end = mesh.Cell1DVertices[e][1];
+
+        for(unsigned int i = 0; i < numVertices; i++)
+            if(vertices[i] == origin)
+                return vertices[(i + 1) % numVertices] == end;
+
+        return false;
+    }
+// ***************************************************************************
+    /// \brief Check the duplicate, dangling and non manifold edges and the orientation of the cells across each edge
+    void CheckEdges(const PolygonalMesh& mesh,
+                    const MeshTopology& topology,
+                    const unsigned int& numThreads,
+                    vector<QualityIssue>& issues)
+    {
+        // two edges with the same ends are both listed by their lower end
+        ParallelCollect(mesh.NumberCell0D, numThreads, [&](const unsigned int& first, const unsigned int& last, vector<QualityIssue>& chunk)
+        {
+            for(unsigned int v = first; v < last; v++)
+            {
+                const unsigned int* edges = topology.VertexEdges.Begin(v);
+                const unsigned int numEdges = topology.VertexEdges.Size(v);
+
+                for(unsigned int i = 0; i < numEdges; i++)
+                {
+                    const Vector2i& ends = mesh.Cell1DVertices[edges[i]];
+
+                    if(static_cast<unsigned int>(ends.minCoeff()) != v)
+                        continue;
+
+                    for(unsigned int j = 0; j < i; j++)
+                    {
+                        const Vector2i& other = mesh.Cell1DVertices[edges[j]];
+
+                        if(edges[j] != edges[i] && static_cast<unsigned int>(other.minCoeff()) == v && other.maxCoeff() == ends.maxCoeff()){
+                            chunk.push_back({QualityIssueType::DuplicateEdge, edges[i], edges[j], 0.0});
+                            break;
+                        }
+                    }
+                }
+            }
+        }, issues);
+
+        ParallelCollect(mesh.NumberCell1D, numThreads, [&](const unsigned int& first, const unsigned int& last, vector<QualityIssue>& chunk)
+        {
+            for(unsigned int e = first; e < last; e++)
+            {
+                const unsigned int numCells = topology.EdgeCells.Size(e);
+
+                if(numCells == 0)
+                    chunk.push_back({QualityIssueType::DanglingEdge, e, 0, 0.0});
+                else if(numCells > 2)
+                    chunk.push_back({QualityIssueType::NonManifoldEdge, e, 0, double(numCells)});
+                else if(numCells == 2)
+                {
+                    const unsigned int* cells = topology.EdgeCells.Begin(e);
+
+                    if(IsForward(mesh, cells[0], e) == IsForward(mesh, cells[1], e))
+                        chunk.push_back({QualityIssueType::InconsistentOrientation, e, cells[1], 0.0});
+                }
+            }
+        }, issues);
+    }
+// ***************************************************************************
+    /// \brief Check the vertices closer than distance with a hash grid of cells of side distance:
+    /// two close vertices are in the same grid cell or in two neighbouring ones
+    void CheckVertices(const PolygonalMesh& mesh,
+                       const double& distance,
+                       const unsigned int& numThreads,
+                       vector<QualityIssue>& issues)
+    {
+        typedef pair<long long, long long> GridCell;
+
+        vector<pair<GridCell, unsigned int>> grid(mesh.NumberCell0D);
+
+        ParallelRanges(mesh.NumberCell0D, NumRanges(mesh.NumberCell0D, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int v = first; v < last; v++)
+                grid[v] = {GridCell(llround(floor(mesh.Cell0DCoordinates[v](0)/distance)),
+                                    llround(floor(mesh.Cell0DCoordinates[v](1)/distance))), v};
+        });
+
+        // sorting the vertices by grid cell replaces the buckets of a hash table
+        sort(grid.begin(), grid.end());
+
+        ParallelCollect(mesh.NumberCell0D, numThreads, [&](const unsigned int& first, const unsigned int& last, vector<QualityIssue>& chunk)
+        {
+            for(unsigned int k = first; k < last; k++)
+            {
+                const GridCell& cell = grid[k].first;
+                const unsigned int v = grid[k].second;
+                unsigned int closest = v;
+                double closestDistance = numeric_limits<double>::max();
+
+                // the grid cells (i, j - 1), (i, j) and (i, j + 1) are contiguous in the sorted grid
+                for(long long i = cell.first - 1; i <= cell.first + 1; i++)
+                {
+                    auto it = lower_bound(grid.begin(), grid.end(), make_pair(GridCell(i, cell.second - 1), 0u));
+
+                    for(; it != grid.end() && it->first <= GridCell(i, cell.second + 1); it++)
+                    {
+                        if(it->second >= v)
+                            continue;
+
+                        const double d = (mesh.Cell0DCoordinates[it->second] - mesh.Cell0DCoordinates[v]).norm();
+
+                        if(d <= distance && (d < closestDistance || (d == closestDistance && it->second < closest))){
+                            closest = it->second;
+                            closestDistance = d;
+                        }
+                    }
+                }
+
+                if(closest != v)
+                    chunk.push_back({QualityIssueType::DuplicateVertex, v, closest, closestDistance});
+            }
+        }, issues);
+    }
+// ***************************************************************************
+    vector<QualityIssue> CheckQuality(const PolygonalMesh& mesh, const double& tolerance, const unsigned int& numThreads)
+    {
+        MeshGeometry computed;
+        const MeshGeometry& geometry = CachedGeometry(mesh, computed, numThreads);
+        const MeshTopology topology = BuildTopology(mesh, numThreads);
+
+        vector<QualityIssue> issues;
+
+        CheckCells(mesh, geometry, tolerance, numThreads, issues);
+        CheckEdges(mesh, topology, numThreads, issues);
+
+        Vector2d lower = Vector2d::Constant(numeric_limits<double>::max());
+        Vector2d upper = -lower;
+
+        for(const Vector2d& coordinates : mesh.Cell0DCoordinates)
+        {
+            lower = lower.cwiseMin(coordinates);
+            upper = upper.cwiseMax(coordinates);
+        }
+
+        const double diagonal = mesh.NumberCell0D == 0 ? 0.0 : (upper - lower).norm();
+
+        if(diagonal > 0.0)
+            CheckVertices(mesh, tolerance*diagonal, numThreads, issues);
+
+        // there is at most one issue of each type for each id
+        sort(issues.begin(), issues.end(), [](const QualityIssue& a, const QualityIssue& b)
+        {
+            return a.Type != b.Type ? a.Type < b.Type : a.Id < b.Id;
+        });
+
+        return issues;
+    }
+// ***************************************************************************
+    vector<QualityIssue> CheckQuality(PolygonalMesh& mesh, const double& tolerance, const unsigned int& numThreads)
+    {
+        UpdateGeometry(mesh, numThreads);
+
+        return CheckQuality(static_cast<const PolygonalMesh&>(mesh), tolerance, numThreads);
+    }
+// ***************************************************************************
+    string QualityIssueName(const QualityIssueType& type)
+    {
+        switch(type)
+        {
+        case QualityIssueType::ZeroAreaCell: return "ZeroAreaCell";
+        case QualityIssueType::NegativeAreaCell: return "NegativeAreaCell";
+        case QualityIssueType::NonConvexCell: return "NonConvexCell";
+        case QualityIssueType::DuplicateEdge: return "DuplicateEdge";
+        case QualityIssueType::DanglingEdge: return "DanglingEdge";
+        case QualityIssueType::NonManifoldEdge: return "NonManifoldEdge";
+        case QualityIssueType::DuplicateVertex: return "DuplicateVertex";
+        case QualityIssueType::InconsistentOrientation: return "InconsistentOrientation";
+        }
+
+        return "Unknown";
+    }
+// ***************************************************************************
+    bool ExportQualityReport(const vector<QualityIssue>& issues, const string& filePath)
+    {
+        ofstream file(filePath);
+
+        if(file.fail())
+            return false;
+
+        file << "Type;Id;Other;Value" << endl;
+        file << scientific << setprecision(16);
+
+        for(const QualityIssue& issue : issues)
+            file << QualityIssueName(issue.Type) << ";" << issue.Id << ";" << issue.Other << ";" << issue.Value << "\n";
+
+        file.close();
+
+        return !file.fail();
+    }
+
+}
@@ -0,0 +1,56 @@
+#ifndef __MESHQUALITY_H
+#define __MESHQUALITY_H
+
+#include <string>
+#include <vector>
+#include "polygonalMesh.hpp"
+
+namespace PolygonalLibrary {
+
+  enum class QualityIssueType
+  {
+    ZeroAreaCell, ///< Id: the Cell2D, Value: its area
+    NegativeAreaCell, ///< Id: the Cell2D with clockwise vertices, Value: its area
+    NonConvexCell, ///< Id: the Cell2D, Other: a vertex with a reflex angle
+    DuplicateEdge, ///< Id: the Cell1D, Other: a Cell1D with a lower id and the same ends
+    DanglingEdge, ///< Id: the Cell1D, which is not an edge of any Cell2D
+    NonManifoldEdge, ///< Id: the Cell1D, which is an edge of more than two Cell2Ds, Value: the number of Cell2Ds
+    DuplicateVertex, ///< Id: the Cell0D, Other: a Cell0D with a lower id at a distance not larger than the tolerance, Value: the distance
+    InconsistentOrientation ///< Id: the Cell1D whose two Cell2Ds run it in the same direction, Other: the second Cell2D
+  };
+
+  struct QualityIssue
+  {
+    QualityIssueType Type;
+    unsigned int Id;
+    unsigned int Other;
+    double Value;
+  };
+
+  ///\brief Check the quality of a mesh: degenerate, clockwise and non convex cells, duplicate, dangling and non manifold edges,
+  /// duplicate vertices (with a hash grid of the coordinates) and cells with inconsistent orientation
+  ///\param mesh: a PolygonalMesh struct, whose connectivity is valid (see ValidateMesh)
+  ///\param tolerance: relative tolerance, scaled by the squared perimeter of the cell for the areas, by the lengths
+  /// of the two sides for the angles and by the diagonal of the mesh bounding box for the distance of the vertices
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  ///\return the issues ordered by type and then by id, empty for a good mesh
+  /// The areas come from the geometry cached on the mesh when it is up to date (see CachedGeometry)
+  std::vector<QualityIssue> CheckQuality(const PolygonalMesh& mesh,
+                                         const double& tolerance = 1.0e-10,
+                                         const unsigned int& numThreads = 1);
+
+  ///\brief CheckQuality, bringing the geometry cached on the mesh up to date first (see UpdateGeometry)
+  std::vector<QualityIssue> CheckQuality(PolygonalMesh& mesh,
+                                         const double& tolerance = 1.0e-10,
+                                         const unsigned int& numThreads = 1);
+
+  ///\brief The name of the type in the reports
+  std::string QualityIssueName(const QualityIssueType& type);
+
+  ///\brief Export the issues in a ';' separated file with header Type;Id;Other;Value, as the mesh files
+  ///\return the result of the writing, true if is success, false otherwise
+  bool ExportQualityReport(const std::vector<QualityIssue>& issues, const std::string& filePath);
+
+}
+
+#endif // __MESHQUALITY_H
@@ -0,0 +1,286 @@
+#include "meshRefinement.hpp"
+#include "meshMarkers.hpp"
+#include "meshTopology.hpp"
+#include "meshValidation.hpp"
+#include "parallel.hpp"
+
+#include <initializer_list>
+#include <numeric>
+
+namespace PolygonalLibrary {
+
+    /// \brief The marker of each cell from a marker table, 0 for the cells without marker
+    vector<unsigned int> ExpandMarkers(const MarkerTable& markers, const unsigned int& numCells)
+    {
+        vector<unsigned int> cellMarkers(numCells, 0);
+
+        for(unsigned int k = 0; k < markers.Size(); k++)
+            for(const unsigned int* id = markers.Begin(k); id != markers.End(k); id++)
+                cellMarkers[*id] = markers.Keys[k];
+
+        return cellMarkers;
+    }
+// ***************************************************************************
+    /// \brief Exclusive prefix sum of counts, returns the total
+    unsigned int ExclusiveScan(vector<unsigned int>& counts)
+    {
+        unsigned int total = 0;
+
+        for(unsigned int& count : counts)
+        {
+            const unsigned int next = total + count;
+            count = total;
+            total = next;
+        }
+
+        return total;
+    }
+// ***************************************************************************
+    PolygonalMesh RefineMesh(const PolygonalMesh& mesh, const vector<bool>& refineCells, const unsigned int& numThreads)
+    {
+        const unsigned int numVertices = mesh.NumberCell0D;
+        const unsigned int numEdges = mesh.NumberCell1D;
+        const unsigned int numCells = mesh.NumberCell2D;
+
+        // the cells are walked as edge k between the vertices k and k + 1: any other mesh would be read out of bounds
+        if(refineCells.size() != numCells || !ValidateMesh(mesh, numThreads).empty())
+            return PolygonalMesh();
+
+        // an edge is split if one of its cells is refined: each edge reads its own cells, so no two threads write the same flag
+        CsrArray edgeCells;
+        TransposeCsr(mesh.Cell2DEdges, numEdges, numThreads, edgeCells);
+
+        vector<unsigned int> splitRanks(numEdges, 0);
+
+        ParallelRanges(numEdges, NumRanges(numEdges, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int e = first; e < last; e++)
+                for(const unsigned int* c = edgeCells.Begin(e); c != edgeCells.End(e); c++)
+                    if(refineCells[*c])
+                        splitRanks[e] = 1;
+        });
+
+        const vector<unsigned int> split = splitRanks;
+        const unsigned int numSplit = ExclusiveScan(splitRanks);
+
+        // what each cell adds: a centre vertex, its internal edges, its children but the first one and its list entries
+        vector<unsigned int> centreRanks(numCells), internalEdgeRanks(numCells), childRanks(numCells), entryCounts(numCells);
+
+        ParallelRanges(numCells, NumRanges(numCells, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int c = first; c < last; c++)
+            {
+                const unsigned int n = mesh.Cell2DVertices.Size(c);
+                const bool triangle = n == 3;
+
+                centreRanks[c] = refineCells[c] && !triangle;
+                internalEdgeRanks[c] = refineCells[c] ? n : 0;
+                childRanks[c] = refineCells[c] ? (triangle ? 3 : n - 1) : 0;
+                entryCounts[c] = refineCells[c] ? (triangle ? 12 : 4*n) : n;
+
+                if(!refineCells[c])
+                    for(const unsigned int* e = mesh.Cell2DEdges.Begin(c); e != mesh.Cell2DEdges.End(c); e++)
+                        entryCounts[c] += split[*e];
+            }
+        });
+
+        const unsigned int numCentres = ExclusiveScan(centreRanks);
+        const unsigned int numInternalEdges = ExclusiveScan(internalEdgeRanks);
+        const unsigned int numChildren = ExclusiveScan(childRanks);
+
+        // the output arrays are sized once: the first midpoint, half edge, internal edge and child of each kind
+        const unsigned int firstMidpoint = numVertices;
+        const unsigned int firstCentre = firstMidpoint + numSplit;
+        const unsigned int firstHalf = numEdges;
+        const unsigned int firstInternalEdge = firstHalf + numSplit;
+        const unsigned int firstChild = numCells;
+
+        PolygonalMesh refined;
+        refined.NumberCell0D = firstCentre + numCentres;
+        refined.NumberCell1D = firstInternalEdge + numInternalEdges;
+        refined.NumberCell2D = firstChild + numChildren;
+
+        refined.Cell0DCoordinates.resize(refined.NumberCell0D);
+        refined.Cell1DVertices.resize(refined.NumberCell1D);
+        refined.Cell2DMarker.resize(refined.NumberCell2D);
+
+        vector<unsigned int> vertexMarkers = ExpandMarkers(mesh.Cell0DMarkers, numVertices);
+        vector<unsigned int> edgeMarkers = ExpandMarkers(mesh.Cell1DMarkers, numEdges);
+        vertexMarkers.resize(refined.NumberCell0D, 0);
+        edgeMarkers.resize(refined.NumberCell1D, 0);
+
+        copy(mesh.Cell0DCoordinates.begin(), mesh.Cell0DCoordinates.end(), refined.Cell0DCoordinates.begin());
+
+        // the edges: the midpoints and the two halves of the split ones
+        ParallelRanges(numEdges, NumRanges(numEdges, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int e = first; e < last; e++)
+            {
+                const unsigned int origin = mesh.Cell1DVertices[e][0];
+                const unsigned int end = mesh.Cell1DVertices[e][1];
+
+                if(!split[e]){
+                    refined.Cell1DVertices[e] = mesh.Cell1DVertices[e];
+                    continue;
+                }
+
+                const unsigned int midpoint = firstMidpoint + splitRanks[e];
+                refined.Cell0DCoordinates[midpoint] = 0.5*(mesh.Cell0DCoordinates[origin] + mesh.Cell0DCoordinates[end]);
+                vertexMarkers[midpoint] = edgeMarkers[e];
+
+                refined.Cell1DVertices[e] << origin, midpoint;
+                refined.Cell1DVertices[firstHalf + splitRanks[e]] << midpoint, end;
+                edgeMarkers[firstHalf + splitRanks[e]] = edgeMarkers[e];
+            }
+        });
+
+        // the position of the child k of each cell: the first one keeps the position of the cell
+        auto child = [&](const unsigned int& c, const unsigned int& k) { return k == 0 ? c : firstChild + childRanks[c] + k - 1; };
+
+        // the sizes of the new cells, then their offsets
+        vector<unsigned int> sizes(refined.NumberCell2D);
+
+        ParallelRanges(numCells, NumRanges(numCells, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int c = first; c < last; c++)
+            {
+                const unsigned int n = mesh.Cell2DVertices.Size(c);
+
+                if(!refineCells[c])
+                    sizes[c] = entryCounts[c];
+                else if(n == 3)
+                    for(unsigned int k = 0; k < 4; k++)
+                        sizes[child(c, k)] = 3;
+                else
+                    for(unsigned int k = 0; k < n; k++)
+                        sizes[child(c, k)] = 4;
+            }
+        });
+
+        refined.Cell2DVertices.Offsets.resize(refined.NumberCell2D + 1);
+        refined.Cell2DVertices.Offsets[0] = 0;
+        partial_sum(sizes.begin(), sizes.end(), refined.Cell2DVertices.Offsets.begin() + 1);
+        refined.Cell2DVertices.Indices.resize(refined.Cell2DVertices.Offsets.back());
+        refined.Cell2DEdges.Offsets = refined.Cell2DVertices.Offsets;
+        refined.Cell2DEdges.Indices.resize(refined.Cell2DVertices.Offsets.back());
+
+        // the cells: each one writes its own entries, internal edges and centre
+        ParallelRanges(numCells, NumRanges(numCells, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int c = first; c < last; c++)
+            {
+                const unsigned int n = mesh.Cell2DVertices.Size(c);
+                const unsigned int* vertices = mesh.Cell2DVertices.Begin(c);
+                const unsigned int* edges = mesh.Cell2DEdges.Begin(c);
+
+                auto midpoint = [&](const unsigned int& k) { return firstMidpoint + splitRanks[edges[k]]; };
+
+                // the half of the edge k from the vertex v, one of its ends
+                auto half = [&](const unsigned int& k, const unsigned int& v)
+                {
+                    return static_cast<unsigned int>(mesh.Cell1DVertices[edges[k]][0]) == v ? edges[k] : firstHalf + splitRanks[edges[k]];
+                };
+
+                auto setCell = [&](const unsigned int& cell, const initializer_list<unsigned int>& cellVertices, const initializer_list<unsigned int>& cellEdges)
+                {
+                    copy(cellVertices.begin(), cellVertices.end(), refined.Cell2DVertices.Begin(cell));
+                    copy(cellEdges.begin(), cellEdges.end(), refined.Cell2DEdges.Begin(cell));
+                    refined.Cell2DMarker[cell] = mesh.Cell2DMarker[c];
+                };
+
+                if(!refineCells[c])
+                {
+                    unsigned int* cellVertices = refined.Cell2DVertices.Begin(c);
+                    unsigned int* cellEdges = refined.Cell2DEdges.Begin(c);
+                    refined.Cell2DMarker[c] = mesh.Cell2DMarker[c];
+
+                    for(unsigned int k = 0; k < n; k++)
+                    {
+                        *cellVertices++ = vertices[k];
+
+                        if(!split[edges[k]]){
+                            *cellEdges++ = edges[k];
+                            continue;
+                        }
+
+                        *cellVertices++ = midpoint(k);
+                        *cellEdges++ = half(k, vertices[k]);
+                        *cellEdges++ = half(k, vertices[(k + 1) % n]);
+                    }
+
+                    continue;
+                }
+
+                const unsigned int internalEdge = firstInternalEdge + internalEdgeRanks[c];
+
+                if(n == 3)
+                {
+                    // the internal edge k joins the midpoints k and k + 1, the corner k is (v_k, m_k, m_k-1)
+                    for(unsigned int k = 0; k < 3; k++)
+                    {
+                        const unsigned int previous = (k + 2) % 3;
+
+                        refined.Cell1DVertices[internalEdge + k] << midpoint(k), midpoint((k + 1) % 3);
+                        setCell(child(c, k),
+                                {vertices[k], midpoint(k), midpoint(previous)},
+                                {half(k, vertices[k]), internalEdge + previous, half(previous, vertices[k])});
+                    }
+
+                    setCell(child(c, 3), {midpoint(0), midpoint(1), midpoint(2)}, {internalEdge, internalEdge + 1, internalEdge + 2});
+
+                    continue;
+                }
+
+                // the internal edge k joins the midpoint k and the centre, the child k is (v_k, m_k, centre, m_k-1)
+                const unsigned int centre = firstCentre + centreRanks[c];
+                Vector2d sum = Vector2d::Zero();
+
+                for(unsigned int k = 0; k < n; k++)
+                {
+                    const unsigned int previous = (k + n - 1) % n;
+
+                    sum += mesh.Cell0DCoordinates[vertices[k]];
+                    refined.Cell1DVertices[internalEdge + k] << midpoint(k), centre;
+                    setCell(child(c, k),
+                            {vertices[k], midpoint(k), centre, midpoint(previous)},
+                            {half(k, vertices[k]), internalEdge + k, internalEdge + previous, half(previous, vertices[k])});
+                }
+
+                refined.Cell0DCoordinates[centre] = sum/n;
+            }
+        });
+
+        refined.Cell0DId.resize(refined.NumberCell0D);
+        refined.Cell1DId.resize(refined.NumberCell1D);
+        refined.Cell2DId.resize(refined.NumberCell2D);
+        iota(refined.Cell0DId.begin(), refined.Cell0DId.end(), 0);
+        iota(refined.Cell1DId.begin(), refined.Cell1DId.end(), 0);
+        iota(refined.Cell2DId.begin(), refined.Cell2DId.end(), 0);
+
+        BuildMarkerTable(vertexMarkers, refined.Cell0DId, refined.Cell0DMarkers);
+        BuildMarkerTable(edgeMarkers, refined.Cell1DId, refined.Cell1DMarkers);
+
+        return refined;
+    }
+// ***************************************************************************
+    PolygonalMesh RefineMesh(const PolygonalMesh& mesh, const unsigned int& numThreads)
+    {
+        return RefineMesh(mesh, vector<bool>(mesh.NumberCell2D, true), numThreads);
+    }
+// ***************************************************************************
+    PolygonalMesh RefineMarkedCells(const PolygonalMesh& mesh, const unsigned int& marker, const unsigned int& numThreads)
+    {
+        vector<bool> refineCells(mesh.NumberCell2D);
+
+        for(unsigned int c = 0; c < mesh.NumberCell2D; c++)
+            refineCells[c] = mesh.Cell2DMarker[c] == marker;
+
+        return RefineMesh(mesh, refineCells, numThreads);
+    }
+
+}
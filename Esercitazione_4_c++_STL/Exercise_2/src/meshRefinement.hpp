@@ -0,0 +1,31 @@
+#ifndef __MESHREFINEMENT_H
+#define __MESHREFINEMENT_H
+
+#include <vector>
+#include "polygonalMesh.hpp"
+
+namespace PolygonalLibrary {
+
+  ///\brief Refine the flagged Cell2Ds: a triangle is split in four by the midpoints of its edges,
+  /// any other polygon in as many quadrilaterals as its vertices by the midpoints and the mean of its vertices.
+  /// A Cell2D which is not refined gains the midpoints of its split edges as vertices (hanging nodes).
+  /// The new Cell0Ds, Cell1Ds and Cell2Ds are appended after the old ones, whose ids do not change:
+  /// a split Cell1D keeps the half starting from its origin, a refined Cell2D keeps its first child.
+  /// The midpoints take the marker of their Cell1D, the halves of a Cell1D its marker, the children of a Cell2D its marker,
+  /// the new internal Cell0Ds and Cell1Ds the marker 0
+  ///\param mesh: a PolygonalMesh struct, whose ids are its positions
+  ///\param refineCells: true for the Cell2Ds to refine, one value for each Cell2D
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  ///\return the refined mesh, whose geometry is to be computed, or an empty mesh if refineCells has the wrong size
+  /// or ValidateMesh finds a defect (as a Cell2D whose edge k is not the Cell1D between its vertices k and k + 1)
+  PolygonalMesh RefineMesh(const PolygonalMesh& mesh, const std::vector<bool>& refineCells, const unsigned int& numThreads = 1);
+
+  ///\brief Refine every Cell2D of the mesh, see RefineMesh
+  PolygonalMesh RefineMesh(const PolygonalMesh& mesh, const unsigned int& numThreads = 1);
+
+  ///\brief Refine the Cell2Ds with the marker, see RefineMesh
+  PolygonalMesh RefineMarkedCells(const PolygonalMesh& mesh, const unsigned int& marker, const unsigned int& numThreads = 1);
+
+}
+
+#endif // __MESHREFINEMENT_H
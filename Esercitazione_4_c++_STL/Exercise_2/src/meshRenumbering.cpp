@@ -0,0 +1,320 @@
+#include "meshRenumbering.hpp"
+#include "meshGeometry.hpp"
+#include "meshTopology.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+namespace PolygonalLibrary {
+
+    unsigned long long MortonKey(const unsigned int& x, const unsigned int& y)
+    {
+        // spread the 16 bits of v to the even bits of a 32 bit word
+        auto spread = [](unsigned long long v)
+        {
+            v &= 0xFFFF;
+            v = (v | (v << 8)) & 0x00FF00FF;
+            v = (v | (v << 4)) & 0x0F0F0F0F;
+            v = (v | (v << 2)) & 0x33333333;
+            v = (v | (v << 1)) & 0x55555555;
+
+            return v;
+        };
+
+        return spread(x) | (spread(y) << 1);
+    }
+// ***************************************************************************
+    unsigned long long HilbertKey(unsigned int x, unsigned int y)
+    {
+        unsigned long long key = 0;
+
+        for(unsigned int s = 1u << 15; s > 0; s >>= 1)
+        {
+            const unsigned int rx = (x & s) > 0;
+            const unsigned int ry = (y & s) > 0;
+            key += static_cast<unsigned long long>(s)*s*((3*rx) ^ ry);
+
+            // rotate the quadrant so that the curve enters it from the right corner
+            if(ry == 0)
+            {
+                if(rx == 1)
+                {
+                    x = s - 1 - (x & (s - 1));
+                    y = s - 1 - (y & (s - 1));
+                }
+
+                swap(x, y);
+            }
+        }
+
+        return key;
+    }
+// ***************************************************************************
+    /// \brief The cells of the mesh in Reverse Cuthill-McKee order of the cell adjacency
+    vector<unsigned int> ReverseCuthillMcKee(const PolygonalMesh& mesh, const unsigned int& numThreads)
+    {
+        const CsrArray& neighbours = BuildTopology(mesh, numThreads).CellNeighbours;
+        const unsigned int numCells = mesh.NumberCell2D;
+
+        vector<unsigned int> order;
+        order.reserve(numCells);
+        vector<bool> visited(numCells, false);
+        vector<unsigned int> level(numCells, 0);
+
+        // breadth first visit from root, the neighbours by increasing degree; returns the first cell of the visit
+        auto visit = [&](const unsigned int& root, vector<unsigned int>& cells)
+        {
+            const unsigned int begin = cells.size();
+            cells.push_back(root);
+            visited[root] = true;
+
+            for(unsigned int k = begin; k < cells.size(); k++)
+            {
+                const unsigned int c = cells[k];
+                const unsigned int firstNew = cells.size();
+
+                for(const unsigned int* n = neighbours.Begin(c); n != neighbours.End(c); n++)
+                {
+                    if(!visited[*n])
+                    {
+                        visited[*n] = true;
+                        level[*n] = level[c] + 1;
+                        cells.push_back(*n);
+                    }
+                }
+
+                sort(cells.begin() + firstNew, cells.end(), [&](const unsigned int& a, const unsigned int& b)
+                {
+                    return neighbours.Size(a) != neighbours.Size(b) ? neighbours.Size(a) < neighbours.Size(b) : a < b;
+                });
+            }
+
+            return begin;
+        };
+
+        vector<unsigned int> component;
+
+        for(unsigned int start = 0; start < numCells; start++)
+        {
+            if(visited[start])
+                continue;
+
+            // pseudo peripheral root: restart from a cell of minimum degree in the last level while the depth grows
+            unsigned int root = start, depth = 0;
+
+            for(unsigned int attempt = 0; attempt < 4; attempt++)
+            {
+                component.clear();
+                level[root] = 0;
+                visit(root, component);
+
+                for(const unsigned int& c : component)
+                    visited[c] = false;
+
+                const unsigned int componentDepth = level[component.back()];
+
+                if(attempt > 0 && componentDepth <= depth)
+                    break;
+
+                depth = componentDepth;
+                unsigned int candidate = component.back();
+
+                for(const unsigned int& c : component)
+                    if(level[c] == depth && neighbours.Size(c) < neighbours.Size(candidate))
+                        candidate = c;
+
+                root = candidate;
+            }
+
+            level[root] = 0;
+            visit(root, order);
+        }
+
+        reverse(order.begin(), order.end());
+
+        return order;
+    }
+// ***************************************************************************
+    /// \brief The cells of the mesh sorted along a space filling curve through their centroids
+    vector<unsigned int> SpaceFillingCurve(const PolygonalMesh& mesh, const RenumberingMethod& method, const unsigned int& numThreads)
+    {
+        MeshGeometry computed;
+        const MeshGeometry& geometry = CachedGeometry(mesh, computed, numThreads);
+
+        const unsigned int numCells = mesh.NumberCell2D;
+        double lowerX = numeric_limits<double>::max(), lowerY = lowerX, upperX = -lowerX, upperY = -lowerX;
+
+        for(unsigned int c = 0; c < numCells; c++)
+        {
+            lowerX = min(lowerX, geometry.CellCentroidsX[c]);
+            lowerY = min(lowerY, geometry.CellCentroidsY[c]);
+            upperX = max(upperX, geometry.CellCentroidsX[c]);
+            upperY = max(upperY, geometry.CellCentroidsY[c]);
+        }
+
+        // the same scale on both axes keeps the curve cells square
+        const double scale = 65535.0/max(max(upperX - lowerX, upperY - lowerY), 1.0e-300);
+        vector<pair<unsigned long long, unsigned int>> keys(numCells);
+
+        ParallelRanges(numCells, NumRanges(numCells, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int c = first; c < last; c++)
+            {
+                const unsigned int x = static_cast<unsigned int>((geometry.CellCentroidsX[c] - lowerX)*scale);
+                const unsigned int y = static_cast<unsigned int>((geometry.CellCentroidsY[c] - lowerY)*scale);
+
+                keys[c] = {method == RenumberingMethod::Morton ? MortonKey(x, y) : HilbertKey(x, y), c};
+            }
+        });
+
+        sort(keys.begin(), keys.end());
+
+        vector<unsigned int> order(numCells);
+
+        for(unsigned int k = 0; k < numCells; k++)
+            order[k] = keys[k].second;
+
+        return order;
+    }
+// ***************************************************************************
+    MeshPermutation ComputeRenumbering(const PolygonalMesh& mesh, const RenumberingMethod& method, const unsigned int& numThreads)
+    {
+        const vector<unsigned int> order = method == RenumberingMethod::ReverseCuthillMcKee ?
+                                           ReverseCuthillMcKee(mesh, numThreads) :
+                                           SpaceFillingCurve(mesh, method, numThreads);
+
+        MeshPermutation permutation;
+        permutation.Cell2Ds.resize(mesh.NumberCell2D);
+
+        for(unsigned int k = 0; k < order.size(); k++)
+            permutation.Cell2Ds[order[k]] = k;
+
+        // the vertices and the edges follow the first cell using them, the unused ones go at the end in their order
+        auto firstTouch = [&](const CsrArray& cellLists, const unsigned int& numItems, vector<unsigned int>& positions)
+        {
+            const unsigned int unset = numeric_limits<unsigned int>::max();
+            positions.assign(numItems, unset);
+            unsigned int next = 0;
+
+            for(const unsigned int& c : order)
+                for(const unsigned int* it = cellLists.Begin(c); it != cellLists.End(c); it++)
+                    if(positions[*it] == unset)
+                        positions[*it] = next++;
+
+            for(unsigned int& position : positions)
+                if(position == unset)
+                    position = next++;
+        };
+
+        firstTouch(mesh.Cell2DVertices, mesh.NumberCell0D, permutation.Cell0Ds);
+        firstTouch(mesh.Cell2DEdges, mesh.NumberCell1D, permutation.Cell1Ds);
+
+        return permutation;
+    }
+// ***************************************************************************
+    /// \brief Remap the ids of a marker table, each marker keeps its ids in increasing order
+    void RenumberMarkers(MarkerTable& markers, const vector<unsigned int>& positions)
+    {
+        for(unsigned int k = 0; k < markers.Size(); k++)
+        {
+            unsigned int* begin = markers.Ids.Begin(k);
+            unsigned int* end = markers.Ids.End(k);
+
+            for(unsigned int* id = begin; id != end; id++)
+                *id = positions[*id];
+
+            sort(begin, end);
+        }
+    }
+// ***************************************************************************
+    /// \brief Move the list c of array to the position positions[c], renaming its entries with entryPositions
+    void RenumberCsr(CsrArray& array, const vector<unsigned int>& positions, const vector<unsigned int>& entryPositions, const unsigned int& numThreads)
+    {
+        const unsigned int numLists = array.Size();
+        CsrArray renumbered;
+        renumbered.Offsets.assign(numLists + 1, 0);
+
+        for(unsigned int c = 0; c < numLists; c++)
+            renumbered.Offsets[positions[c] + 1] = array.Size(c);
+
+        for(unsigned int c = 0; c < numLists; c++)
+            renumbered.Offsets[c + 1] += renumbered.Offsets[c];
+
+        renumbered.Indices.resize(array.Indices.size());
+
+        ParallelRanges(numLists, NumRanges(numLists, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int c = first; c < last; c++)
+            {
+                unsigned int* destination = renumbered.Begin(positions[c]);
+
+                for(const unsigned int* it = array.Begin(c); it != array.End(c); it++)
+                    *destination++ = entryPositions[*it];
+            }
+        });
+
+        array = std::move(renumbered);
+    }
+// ***************************************************************************
+    void RenumberMesh(PolygonalMesh& mesh, const MeshPermutation& permutation, const unsigned int& numThreads)
+    {
+        vector<Vector2d> coordinates(mesh.NumberCell0D);
+        vector<Vector2i> edgeVertices(mesh.NumberCell1D);
+        vector<unsigned int> cellMarkers(mesh.NumberCell2D);
+
+        ParallelRanges(mesh.NumberCell0D, NumRanges(mesh.NumberCell0D, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int v = first; v < last; v++)
+                coordinates[permutation.Cell0Ds[v]] = mesh.Cell0DCoordinates[v];
+        });
+
+        ParallelRanges(mesh.NumberCell1D, NumRanges(mesh.NumberCell1D, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int e = first; e < last; e++)
+                edgeVertices[permutation.Cell1Ds[e]] << permutation.Cell0Ds[mesh.Cell1DVertices[e][0]],
+                                                        permutation.Cell0Ds[mesh.Cell1DVertices[e][1]];
+        });
+
+        for(unsigned int c = 0; c < mesh.NumberCell2D; c++)
+            cellMarkers[permutation.Cell2Ds[c]] = mesh.Cell2DMarker[c];
+
+        mesh.Cell0DCoordinates = std::move(coordinates);
+        mesh.Cell1DVertices = std::move(edgeVertices);
+        mesh.Cell2DMarker = std::move(cellMarkers);
+
+        RenumberCsr(mesh.Cell2DVertices, permutation.Cell2Ds, permutation.Cell0Ds, numThreads);
+        RenumberCsr(mesh.Cell2DEdges, permutation.Cell2Ds, permutation.Cell1Ds, numThreads);
+
+        RenumberMarkers(mesh.Cell0DMarkers, permutation.Cell0Ds);
+        RenumberMarkers(mesh.Cell1DMarkers, permutation.Cell1Ds);
+
+        iota(mesh.Cell0DId.begin(), mesh.Cell0DId.end(), 0);
+        iota(mesh.Cell1DId.begin(), mesh.Cell1DId.end(), 0);
+        iota(mesh.Cell2DId.begin(), mesh.Cell2DId.end(), 0);
+
+        InvalidateGeometry(mesh);
+    }
+// ***************************************************************************
+    MeshPermutation ComputeRenumbering(PolygonalMesh& mesh, const RenumberingMethod& method, const unsigned int& numThreads)
+    {
+        // only the space filling curves use the centroids
+        if(method != RenumberingMethod::ReverseCuthillMcKee)
+            UpdateGeometry(mesh, numThreads);
+
+        return ComputeRenumbering(static_cast<const PolygonalMesh&>(mesh), method, numThreads);
+    }
+// ***************************************************************************
+    void RenumberMesh(PolygonalMesh& mesh, const RenumberingMethod& method, const unsigned int& numThreads)
+    {
+        // the renumbering invalidates the cache, so it is not brought up to date here
+        RenumberMesh(mesh, ComputeRenumbering(static_cast<const PolygonalMesh&>(mesh), method, numThreads), numThreads);
+    }
+
+}
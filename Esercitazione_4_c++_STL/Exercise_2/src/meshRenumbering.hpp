@@ -0,0 +1,52 @@
+#ifndef __MESHRENUMBERING_H
+#define __MESHRENUMBERING_H
+
+#include <vector>
+#include "polygonalMesh.hpp"
+
+namespace PolygonalLibrary {
+
+  enum class RenumberingMethod
+  {
+    ReverseCuthillMcKee, ///< breadth first visit of the cell adjacency, reversed: small bandwidth
+    Morton, ///< cells sorted along the Z order curve through their centroids
+    Hilbert ///< cells sorted along the Hilbert curve through their centroids
+  };
+
+  /// \brief The new position of each Cell0D, Cell1D and Cell2D
+  struct MeshPermutation
+  {
+    std::vector<unsigned int> Cell0Ds;
+    std::vector<unsigned int> Cell1Ds;
+    std::vector<unsigned int> Cell2Ds;
+  };
+
+  ///\brief Compute a renumbering for cache locality: the cells are ordered by the method,
+  /// the vertices and the edges in the order in which the renumbered cells first use them
+  ///\param mesh: a PolygonalMesh struct, whose ids are its positions and whose connectivity is valid (see ValidateMesh)
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  /// The centroids come from the geometry cached on the mesh when it is up to date (see CachedGeometry)
+  MeshPermutation ComputeRenumbering(const PolygonalMesh& mesh, const RenumberingMethod& method, const unsigned int& numThreads = 1);
+
+  ///\brief ComputeRenumbering, bringing the geometry cached on the mesh up to date first when the method needs it (see UpdateGeometry)
+  MeshPermutation ComputeRenumbering(PolygonalMesh& mesh, const RenumberingMethod& method, const unsigned int& numThreads = 1);
+
+  ///\brief Move every Cell0D, Cell1D and Cell2D to its new position, remapping the connectivity and the markers.
+  /// The ids become the new positions and the cached geometry is invalidated
+  ///\param mesh: a PolygonalMesh struct, whose ids are its positions
+  ///\param permutation: the new positions, a permutation of the positions of each kind of cell
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  void RenumberMesh(PolygonalMesh& mesh, const MeshPermutation& permutation, const unsigned int& numThreads = 1);
+
+  ///\brief Compute a renumbering with the method and apply it to the mesh
+  void RenumberMesh(PolygonalMesh& mesh, const RenumberingMethod& method, const unsigned int& numThreads = 1);
+
+  ///\brief The position of the point (x, y) of [0, 2^16) x [0, 2^16) along the Z order curve
+  unsigned long long MortonKey(const unsigned int& x, const unsigned int& y);
+
+  ///\brief The position of the point (x, y) of [0, 2^16) x [0, 2^16) along the Hilbert curve
+  unsigned long long HilbertKey(unsigned int x, unsigned int y);
+
+}
+
+#endif // __MESHRENUMBERING_H
@@ -0,0 +1,124 @@
+#include "meshTopology.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+
+namespace PolygonalLibrary {
+
+    void TransposeCsr(const CsrArray& array, const unsigned int& numTargets, const unsigned int& numThreads, CsrArray& transposed)
+    {
+        const unsigned int numLists = array.Size();
+
+        // every range has its own counters: their memory is kept within twice the entries
+        const size_t maxRanges = max<size_t>(1, 2*array.Indices.size()/max(1u, numTargets));
+        const unsigned int numRanges = min<size_t>(NumRanges(numLists, numThreads), maxRanges);
+
+        // counts[r*numTargets + t]: the entries of the range r of lists equal to t
+        vector<unsigned int> counts(static_cast<size_t>(numRanges)*numTargets, 0);
+
+        ParallelRanges(numLists, numRanges, numThreads, [&](const unsigned int& first, const unsigned int& last, const unsigned int& r)
+        {
+            unsigned int* rangeCounts = counts.data() + static_cast<size_t>(r)*numTargets;
+
+            for(const unsigned int* it = array.Begin(first); it != array.Begin(last); it++)
+                rangeCounts[*it]++;
+        });
+
+        // exclusive scan in target-major order: the range r writes the target t from counts[r*numTargets + t]
+        transposed.Offsets.assign(numTargets + 1, 0);
+        unsigned int offset = 0;
+
+        for(unsigned int t = 0; t < numTargets; t++)
+        {
+            transposed.Offsets[t] = offset;
+
+            for(unsigned int r = 0; r < numRanges; r++)
+            {
+                const unsigned int count = counts[static_cast<size_t>(r)*numTargets + t];
+                counts[static_cast<size_t>(r)*numTargets + t] = offset;
+                offset += count;
+            }
+        }
+
+        transposed.Offsets[numTargets] = offset;
+        transposed.Indices.resize(offset);
+
+        // the ranges cover increasing lists, so each transposed list comes out sorted
+        ParallelRanges(numLists, numRanges, numThreads, [&](const unsigned int& first, const unsigned int& last, const unsigned int& r)
+        {
+            unsigned int* slots = counts.data() + static_cast<size_t>(r)*numTargets;
+
+            for(unsigned int c = first; c < last; c++)
+                for(const unsigned int* it = array.Begin(c); it != array.End(c); it++)
+                    transposed.Indices[slots[*it]++] = c;
+        });
+    }
+// ***************************************************************************
+    /// \brief The Cell2Ds across the edges of the cell c, without repetitions
+    void CellNeighbours(const PolygonalMesh& mesh, const CsrArray& edgeCells, const unsigned int& c, vector<unsigned int>& neighbours)
+    {
+        neighbours.clear();
+
+        for(const unsigned int* edge = mesh.Cell2DEdges.Begin(c); edge != mesh.Cell2DEdges.End(c); edge++)
+            for(const unsigned int* cell = edgeCells.Begin(*edge); cell != edgeCells.End(*edge); cell++)
+                if(*cell != c && find(neighbours.begin(), neighbours.end(), *cell) == neighbours.end())
+                    neighbours.push_back(*cell);
+    }
+// ***************************************************************************
+    MeshTopology BuildTopology(const PolygonalMesh& mesh, const unsigned int& numThreads)
+    {
+        MeshTopology topology;
+
+        CsrArray edgeVertices;
+        edgeVertices.Offsets.resize(mesh.NumberCell1D + 1);
+        edgeVertices.Indices.resize(2*mesh.NumberCell1D);
+
+        for(unsigned int e = 0; e <= mesh.NumberCell1D; e++)
+            edgeVertices.Offsets[e] = 2*e;
+
+        for(unsigned int e = 0; e < mesh.NumberCell1D; e++)
+        {
+            edgeVertices.Indices[2*e] = mesh.Cell1DVertices[e][0];
+            edgeVertices.Indices[2*e + 1] = mesh.Cell1DVertices[e][1];
+        }
+
+        TransposeCsr(edgeVertices, mesh.NumberCell0D, numThreads, topology.VertexEdges);
+        TransposeCsr(mesh.Cell2DVertices, mesh.NumberCell0D, numThreads, topology.VertexCells);
+        TransposeCsr(mesh.Cell2DEdges, mesh.NumberCell1D, numThreads, topology.EdgeCells);
+
+        // the neighbours are counted, then written in place once the offsets are known
+        const unsigned int numRanges = NumRanges(mesh.NumberCell2D, numThreads);
+        CsrArray& neighbours = topology.CellNeighbours;
+        neighbours.Offsets.assign(mesh.NumberCell2D + 1, 0);
+
+        ParallelRanges(mesh.NumberCell2D, numRanges, numThreads, [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            vector<unsigned int> cells;
+
+            for(unsigned int c = first; c < last; c++)
+            {
+                CellNeighbours(mesh, topology.EdgeCells, c, cells);
+                neighbours.Offsets[c + 1] = cells.size();
+            }
+        });
+
+        for(unsigned int c = 0; c < mesh.NumberCell2D; c++)
+            neighbours.Offsets[c + 1] += neighbours.Offsets[c];
+
+        neighbours.Indices.resize(neighbours.Offsets.back());
+
+        ParallelRanges(mesh.NumberCell2D, numRanges, numThreads, [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            vector<unsigned int> cells;
+
+            for(unsigned int c = first; c < last; c++)
+            {
+                CellNeighbours(mesh, topology.EdgeCells, c, cells);
+                copy(cells.begin(), cells.end(), neighbours.Begin(c));
+            }
+        });
+
+        return topology;
+    }
+
+}
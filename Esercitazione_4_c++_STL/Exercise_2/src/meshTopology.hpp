@@ -0,0 +1,32 @@
+#ifndef __MESHTOPOLOGY_H
+#define __MESHTOPOLOGY_H
+
+#include "polygonalMesh.hpp"
+
+namespace PolygonalLibrary {
+
+  /// \brief The adjacency maps of a mesh in CSR form, each list is sorted by increasing id
+  /// unless stated otherwise
+  struct MeshTopology
+  {
+    CsrArray VertexEdges; ///< the Cell1Ds ending in each Cell0D
+    CsrArray VertexCells; ///< the Cell2Ds with each Cell0D as vertex
+    CsrArray EdgeCells; ///< the Cell2Ds with each Cell1D as edge: one for a boundary edge, two for an internal one
+    CsrArray CellNeighbours; ///< the Cell2Ds sharing an edge with each Cell2D, in the order of the edges of the cell
+  };
+
+  ///\brief Transpose a CSR array: the list t of transposed holds the lists of array which contain t
+  ///\param array: lists of indices in [0, numTargets)
+  ///\param numTargets: the number of lists of transposed
+  ///\param numThreads: the number of threads of the counting sort, 0 means all the hardware threads
+  ///\param transposed: the resulting CSR array, each list is sorted
+  void TransposeCsr(const CsrArray& array, const unsigned int& numTargets, const unsigned int& numThreads, CsrArray& transposed);
+
+  ///\brief Build the adjacency maps of a mesh with parallel counting sorts over Cell1DVertices, Cell2DVertices and Cell2DEdges
+  ///\param mesh: a PolygonalMesh struct, whose ids are its positions and whose connectivity is valid (see ValidateMesh)
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  MeshTopology BuildTopology(const PolygonalMesh& mesh, const unsigned int& numThreads = 1);
+
+}
+
+#endif // __MESHTOPOLOGY_H
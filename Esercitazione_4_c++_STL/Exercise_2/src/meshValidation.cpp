@@ -0,0 +1,119 @@
+#include "meshValidation.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+
+namespace PolygonalLibrary {
+
+    vector<MeshDefect> ValidateMesh(const PolygonalMesh& mesh, const unsigned int& numThreads)
+    {
+        vector<MeshDefect> defects;
+
+        ParallelCollect(mesh.NumberCell1D, numThreads, [&](const unsigned int& first, const unsigned int& last, vector<MeshDefect>& chunk)
+        {
+            for(unsigned int e = first; e < last; e++)
+                for(unsigned int i = 0; i < 2; i++)
+                    if(static_cast<unsigned int>(mesh.Cell1DVertices[e][i]) >= mesh.NumberCell0D)
+                        chunk.push_back({MeshDefectType::EdgeVertexOutOfRange, e, static_cast<unsigned int>(mesh.Cell1DVertices[e][i])});
+        }, defects);
+
+        // edges with a wrong vertex id are not checked against the cells
+        vector<bool> wrongEdges(mesh.NumberCell1D, false);
+
+        for(const MeshDefect& defect : defects)
+            wrongEdges[defect.Cell] = true;
+
+        ParallelCollect(mesh.NumberCell2D, numThreads, [&](const unsigned int& first, const unsigned int& last, vector<MeshDefect>& chunk)
+        {
+            // the vertices of a cell are sorted once, then each edge end is a binary search in them
+            vector<unsigned int> vertices;
+
+            for(unsigned int c = first; c < last; c++)
+            {
+                vertices.assign(mesh.Cell2DVertices.Begin(c), mesh.Cell2DVertices.End(c));
+                sort(vertices.begin(), vertices.end());
+
+                if(!vertices.empty() && vertices.back() >= mesh.NumberCell0D)
+                {
+                    for(const unsigned int& v : vertices)
+                        if(v >= mesh.NumberCell0D)
+                            chunk.push_back({MeshDefectType::CellVertexOutOfRange, c, v});
+                }
+
+                const unsigned int n = mesh.Cell2DVertices.Size(c);
+                const unsigned int numEdges = mesh.Cell2DEdges.Size(c);
+                const unsigned int* cellVertices = mesh.Cell2DVertices.Begin(c);
+
+                if(numEdges != n)
+                    chunk.push_back({MeshDefectType::CellSizeMismatch, c, numEdges});
+
+                for(unsigned int k = 0; k < numEdges; k++)
+                {
+                    const unsigned int edge = mesh.Cell2DEdges.Begin(c)[k];
+
+                    if(edge >= mesh.NumberCell1D){
+                        chunk.push_back({MeshDefectType::CellEdgeOutOfRange, c, edge});
+                        continue;
+                    }
+
+                    if(wrongEdges[edge])
+                        continue;
+
+                    const unsigned int origin = mesh.Cell1DVertices[edge][0];
+                    const unsigned int end = mesh.Cell1DVertices[edge][1];
+                    const bool originInCell = binary_search(vertices.begin(), vertices.end(), origin);
+                    const bool endInCell = binary_search(vertices.begin(), vertices.end(), end);
+
+                    if(!originInCell)
+                        chunk.push_back({MeshDefectType::EdgeOriginNotInCell, c, edge});
+
+                    if(!endInCell)
+                        chunk.push_back({MeshDefectType::EdgeEndNotInCell, c, edge});
+
+                    // the order is checked only when the ends are in the cell and the counts agree
+                    if(!originInCell || !endInCell || numEdges != n)
+                        continue;
+
+                    const unsigned int first = cellVertices[k];
+                    const unsigned int second = cellVertices[(k + 1) % n];
+
+                    if(!((origin == first && end == second) || (origin == second && end == first)))
+                        chunk.push_back({MeshDefectType::EdgeNotBetweenVertices, c, edge});
+                }
+            }
+        }, defects);
+
+        return defects;
+    }
+// ***************************************************************************
+    ostream& operator<<(ostream& out, const MeshDefect& defect)
+    {
+        switch(defect.Type)
+        {
+        case MeshDefectType::EdgeVertexOutOfRange:
+            out << "Cell1D " << defect.Cell << ": the vertex " << defect.Index << " is not a Cell0D";
+            break;
+        case MeshDefectType::CellEdgeOutOfRange:
+            out << "Cell2D " << defect.Cell << ": the edge " << defect.Index << " is not a Cell1D";
+            break;
+        case MeshDefectType::CellVertexOutOfRange:
+            out << "Cell2D " << defect.Cell << ": the vertex " << defect.Index << " is not a Cell0D";
+            break;
+        case MeshDefectType::EdgeOriginNotInCell:
+            out << "Cell2D " << defect.Cell << ": the origin of the edge " << defect.Index << " is not a vertex of the cell";
+            break;
+        case MeshDefectType::EdgeEndNotInCell:
+            out << "Cell2D " << defect.Cell << ": the end of the edge " << defect.Index << " is not a vertex of the cell";
+            break;
+        case MeshDefectType::CellSizeMismatch:
+            out << "Cell2D " << defect.Cell << ": " << defect.Index << " edges for a different number of vertices";
+            break;
+        case MeshDefectType::EdgeNotBetweenVertices:
+            out << "Cell2D " << defect.Cell << ": the edge " << defect.Index << " does not join two consecutive vertices of the cell";
+            break;
+        }
+
+        return out;
+    }
+
+}
@@ -0,0 +1,39 @@
+#ifndef __MESHVALIDATION_H
+#define __MESHVALIDATION_H
+
+#include <iostream>
+#include <vector>
+#include "polygonalMesh.hpp"
+
+namespace PolygonalLibrary {
+
+  enum class MeshDefectType
+  {
+    EdgeVertexOutOfRange, ///< an end of the Cell1D is not a Cell0D
+    CellEdgeOutOfRange, ///< an edge of the Cell2D is not a Cell1D
+    CellVertexOutOfRange, ///< a vertex of the Cell2D is not a Cell0D
+    EdgeOriginNotInCell, ///< the origin of an edge of the Cell2D is not a vertex of the Cell2D
+    EdgeEndNotInCell, ///< the end of an edge of the Cell2D is not a vertex of the Cell2D
+    CellSizeMismatch, ///< the Cell2D lists a number of edges different from its number of vertices
+    EdgeNotBetweenVertices ///< the edge k of the Cell2D does not join its vertices k and k + 1
+  };
+
+  struct MeshDefect
+  {
+    MeshDefectType Type;
+    unsigned int Cell; ///< the Cell1D for EdgeVertexOutOfRange, the Cell2D otherwise
+    unsigned int Index; ///< the wrong Cell0D or Cell1D, the number of edges for CellSizeMismatch
+  };
+
+  ///\brief Check that all the ids are in range and that every Cell2D lists as edge k the Cell1D between its vertices k and k + 1,
+  /// as in the mesh files
+  ///\param mesh: a PolygonalMesh struct
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  ///\return all the defects of the mesh, first the Cell1D ones and then the Cell2D ones ordered by cell, empty if the mesh is correct
+  std::vector<MeshDefect> ValidateMesh(const PolygonalMesh& mesh, const unsigned int& numThreads = 1);
+
+  std::ostream& operator<<(std::ostream& out, const MeshDefect& defect);
+
+}
+
+#endif // __MESHVALIDATION_H
@@ -0,0 +1,87 @@
+#ifndef __PARALLEL_H
+#define __PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace PolygonalLibrary {
+
+  ///\brief The number of threads to use
+  ///\param numThreads: the requested number of threads, 0 means all the hardware threads
+  inline unsigned int NumThreads(const unsigned int& numThreads)
+  {
+    return numThreads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : numThreads;
+  }
+
+  ///\brief Call task(t) for every t in [0, numTasks), the tasks are shared by numThreads threads
+  /// through an atomic counter, the calling thread included
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  template<typename Task>
+  void ParallelFor(const unsigned int& numTasks, const unsigned int& numThreads, const Task& task)
+  {
+    const unsigned int threads = std::min(NumThreads(numThreads), numTasks);
+    std::atomic<unsigned int> next(0);
+
+    auto worker = [&]()
+    {
+      for(unsigned int t = next++; t < numTasks; t = next++)
+        task(t);
+    };
+
+    std::vector<std::thread> workers;
+
+    for(unsigned int t = 1; t < threads; t++)
+      workers.push_back(std::thread(worker));
+
+    worker();
+
+    for(std::thread& w : workers)
+      w.join();
+  }
+
+
+  ///\brief Split [0, numItems) in numRanges contiguous ranges of about the same size
+  /// and call task(first, last, range) on every range, the ranges are shared by numThreads threads
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  template<typename Task>
+  void ParallelRanges(const unsigned int& numItems, const unsigned int& numRanges, const unsigned int& numThreads, const Task& task)
+  {
+    ParallelFor(numRanges, numThreads, [&](const unsigned int& r)
+    {
+      task(static_cast<unsigned int>(static_cast<unsigned long long>(numItems)*r/numRanges),
+           static_cast<unsigned int>(static_cast<unsigned long long>(numItems)*(r + 1)/numRanges),
+           r);
+    });
+  }
+
+  ///\brief The number of ranges for ParallelRanges: one per thread, but no range smaller than minRangeSize items
+  inline unsigned int NumRanges(const unsigned int& numItems, const unsigned int& numThreads, const unsigned int& minRangeSize = 1 << 12)
+  {
+    return std::max(1u, std::min(NumThreads(numThreads), numItems/minRangeSize));
+  }
+
+
+  ///\brief Call task(first, last, items) on chunks of [0, numItems) in parallel,
+  /// then append the items found by each chunk to items in chunk order, so that the result does not depend on the threads
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  template<typename T, typename Task>
+  void ParallelCollect(const unsigned int& numItems, const unsigned int& numThreads, const Task& task, std::vector<T>& items)
+  {
+    const unsigned int chunkSize = 1 << 14;
+    const unsigned int numChunks = (numItems + chunkSize - 1)/chunkSize;
+    std::vector<std::vector<T>> chunkItems(numChunks);
+
+    ParallelFor(numChunks, numThreads, [&](const unsigned int& k)
+    {
+      task(k*chunkSize, std::min(numItems, (k + 1)*chunkSize), chunkItems[k]);
+    });
+
+    for(const std::vector<T>& chunk : chunkItems)
+      items.insert(items.end(), chunk.begin(), chunk.end());
+  }
+
+}
+
+#endif // __PARALLEL_H
@@ -0,0 +1,105 @@
+#ifndef __POLYGONALMESH_H
+#define __POLYGONALMESH_H
+
+#include <algorithm>
+#include <vector>
+#include "Eigen/Eigen"
+
+using namespace std;
+using namespace Eigen;
+
+namespace PolygonalLibrary {
+
+  /// \brief Lists of different lengths stored in two contiguous buffers (compressed sparse rows):
+  /// the list c is Indices[Offsets[c], Offsets[c + 1])
+  struct CsrArray
+  {
+    std::vector<unsigned int> Offsets = {0};
+    std::vector<unsigned int> Indices;
+
+    /// \brief the number of lists
+    unsigned int Size() const { return Offsets.size() - 1; }
+
+    /// \brief the length of the list c
+    unsigned int Size(const unsigned int& c) const { return Offsets[c + 1] - Offsets[c]; }
+
+    const unsigned int* Begin(const unsigned int& c) const { return Indices.data() + Offsets[c]; }
+    const unsigned int* End(const unsigned int& c) const { return Indices.data() + Offsets[c + 1]; }
+
+    unsigned int* Begin(const unsigned int& c) { return Indices.data() + Offsets[c]; }
+    unsigned int* End(const unsigned int& c) { return Indices.data() + Offsets[c + 1]; }
+
+    /// \brief Reserve the buffers for numLists lists with numIndices indices in total
+    void Reserve(const unsigned int& numLists, const unsigned int& numIndices)
+    {
+      Offsets.reserve(numLists + 1);
+      Indices.reserve(numIndices);
+    }
+
+    /// \brief Append a new list at the end
+    template<typename Iterator>
+    void PushBack(Iterator first, Iterator last)
+    {
+      Indices.insert(Indices.end(), first, last);
+      Offsets.push_back(Indices.size());
+    }
+  };
+
+  /// \brief The ids of the cells with each marker, grouped in one CSR array:
+  /// the cells with marker Keys[k] are Ids[Ids.Offsets[k], Ids.Offsets[k + 1]), in increasing order of position
+  struct MarkerTable
+  {
+    std::vector<unsigned int> Keys; ///< the markers, sorted
+    CsrArray Ids;
+
+    /// \brief the number of markers
+    unsigned int Size() const { return Keys.size(); }
+
+    /// \brief the position k of marker in Keys, Size() if there is no cell with marker
+    unsigned int Find(const unsigned int& marker) const
+    {
+      const auto it = std::lower_bound(Keys.begin(), Keys.end(), marker);
+
+      return it != Keys.end() && *it == marker ? it - Keys.begin() : Size();
+    }
+
+    const unsigned int* Begin(const unsigned int& k) const { return Ids.Begin(k); }
+    const unsigned int* End(const unsigned int& k) const { return Ids.End(k); }
+  };
+
+  /// \brief The geometric quantities of a mesh, computed by UpdateGeometry (see meshGeometry.hpp)
+  struct MeshGeometry
+  {
+    std::vector<double> CellAreas; ///< signed: positive for counterclockwise Cell2Ds
+    std::vector<double> CellCentroidsX;
+    std::vector<double> CellCentroidsY;
+    std::vector<double> EdgeLengths;
+  };
+
+  struct PolygonalMesh
+  {
+      unsigned int NumberCell0D;
+      std::vector<unsigned int> Cell0DId;
+      std::vector<Vector2d> Cell0DCoordinates;
+      MarkerTable Cell0DMarkers;
+
+      unsigned int NumberCell1D;
+      std::vector<unsigned int> Cell1DId;
+      std::vector<Vector2i> Cell1DVertices;
+      MarkerTable Cell1DMarkers;
+
+      unsigned int NumberCell2D;
+      std::vector<unsigned int> Cell2DId;
+      std::vector<unsigned int> Cell2DMarker;
+      CsrArray Cell2DVertices;
+      CsrArray Cell2DEdges;
+
+      /// the cached geometry, to be recomputed when GeometryUpToDate is false:
+      /// whoever changes Cell0DCoordinates or the cells has to reset it (see InvalidateGeometry)
+      MeshGeometry Geometry;
+      bool GeometryUpToDate = false;
+  };
+
+}
+
+#endif // __POLYGONALMESH_H
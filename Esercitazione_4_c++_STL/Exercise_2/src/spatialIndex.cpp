@@ -0,0 +1,320 @@
+#include "spatialIndex.hpp"
+#include "meshTopology.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace PolygonalLibrary {
+
+    SpatialIndex BuildSpatialIndex(const PolygonalMesh& mesh, const unsigned int& numThreads, const double& cellsPerBucket)
+    {
+        SpatialIndex index;
+
+        index.CellMinX.resize(mesh.NumberCell2D);
+        index.CellMinY.resize(mesh.NumberCell2D);
+        index.CellMaxX.resize(mesh.NumberCell2D);
+        index.CellMaxY.resize(mesh.NumberCell2D);
+
+        ParallelRanges(mesh.NumberCell2D, NumRanges(mesh.NumberCell2D, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int c = first; c < last; c++)
+            {
+                double minX = numeric_limits<double>::max(), minY = minX, maxX = -minX, maxY = -minX;
+
+                for(const unsigned int* v = mesh.Cell2DVertices.Begin(c); v != mesh.Cell2DVertices.End(c); v++)
+                {
+                    minX = min(minX, mesh.Cell0DCoordinates[*v](0));
+                    minY = min(minY, mesh.Cell0DCoordinates[*v](1));
+                    maxX = max(maxX, mesh.Cell0DCoordinates[*v](0));
+                    maxY = max(maxY, mesh.Cell0DCoordinates[*v](1));
+                }
+
+                index.CellMinX[c] = minX;
+                index.CellMinY[c] = minY;
+                index.CellMaxX[c] = maxX;
+                index.CellMaxY[c] = maxY;
+            }
+        });
+
+        double lowerX = numeric_limits<double>::max(), lowerY = lowerX, upperX = -lowerX, upperY = -lowerX;
+
+        for(const Vector2d& coordinates : mesh.Cell0DCoordinates)
+        {
+            lowerX = min(lowerX, coordinates(0));
+            lowerY = min(lowerY, coordinates(1));
+            upperX = max(upperX, coordinates(0));
+            upperY = max(upperY, coordinates(1));
+        }
+
+        if(mesh.NumberCell0D == 0)
+            lowerX = lowerY = upperX = upperY = 0.0;
+
+        // about cellsPerBucket cells in each bucket, with buckets as square as the bounding box allows
+        const double width = max(upperX - lowerX, 1.0e-300), height = max(upperY - lowerY, 1.0e-300);
+        const double numBuckets = max(1.0, max(mesh.NumberCell2D, mesh.NumberCell0D)/max(cellsPerBucket, 1.0e-3));
+        const double side = sqrt(width*height/numBuckets);
+
+        auto numSides = [&](const double& length)
+        {
+            return static_cast<unsigned int>(min(max(1.0, ceil(length/side)), numBuckets));
+        };
+
+        index.NumX = numSides(width);
+        index.NumY = numSides(height);
+        index.LowerX = lowerX;
+        index.LowerY = lowerY;
+        index.BucketSizeX = width/index.NumX;
+        index.BucketSizeY = height/index.NumY;
+
+        const unsigned int numGridBuckets = index.NumX*index.NumY;
+
+        // the lists vertex -> bucket and cell -> overlapped buckets, transposed by a counting sort
+        CsrArray vertexBuckets;
+        vertexBuckets.Offsets.resize(mesh.NumberCell0D + 1);
+        vertexBuckets.Indices.resize(mesh.NumberCell0D);
+
+        ParallelRanges(mesh.NumberCell0D, NumRanges(mesh.NumberCell0D, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int v = first; v < last; v++)
+            {
+                vertexBuckets.Offsets[v + 1] = v + 1;
+                vertexBuckets.Indices[v] = index.BucketY(mesh.Cell0DCoordinates[v](1))*index.NumX + index.BucketX(mesh.Cell0DCoordinates[v](0));
+            }
+        });
+
+        TransposeCsr(vertexBuckets, numGridBuckets, numThreads, index.BucketVertices);
+
+        CsrArray cellBuckets;
+        cellBuckets.Offsets.assign(mesh.NumberCell2D + 1, 0);
+
+        ParallelRanges(mesh.NumberCell2D, NumRanges(mesh.NumberCell2D, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int c = first; c < last; c++)
+                cellBuckets.Offsets[c + 1] = (index.BucketX(index.CellMaxX[c]) - index.BucketX(index.CellMinX[c]) + 1)*
+                                             (index.BucketY(index.CellMaxY[c]) - index.BucketY(index.CellMinY[c]) + 1);
+        });
+
+        for(unsigned int c = 0; c < mesh.NumberCell2D; c++)
+            cellBuckets.Offsets[c + 1] += cellBuckets.Offsets[c];
+
+        cellBuckets.Indices.resize(cellBuckets.Offsets.back());
+
+        ParallelRanges(mesh.NumberCell2D, NumRanges(mesh.NumberCell2D, numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int c = first; c < last; c++)
+            {
+                unsigned int* bucket = cellBuckets.Begin(c);
+
+                for(unsigned int j = index.BucketY(index.CellMinY[c]); j <= index.BucketY(index.CellMaxY[c]); j++)
+                    for(unsigned int i = index.BucketX(index.CellMinX[c]); i <= index.BucketX(index.CellMaxX[c]); i++)
+                        *bucket++ = j*index.NumX + i;
+            }
+        });
+
+        TransposeCsr(cellBuckets, numGridBuckets, numThreads, index.BucketCells);
+
+        return index;
+    }
+// ***************************************************************************
+    bool IsInsideCell(const PolygonalMesh& mesh, const unsigned int& c, const Vector2d& point)
+    {
+        const unsigned int* vertices = mesh.Cell2DVertices.Begin(c);
+        const unsigned int numVertices = mesh.Cell2DVertices.Size(c);
+        bool inside = false;
+
+        // the edges are half open in y, so that a point on the edge shared by two cells is inside only one of them
+        for(unsigned int i = 0, j = numVertices - 1; i < numVertices; j = i++)
+        {
+            const Vector2d& a = mesh.Cell0DCoordinates[vertices[i]];
+            const Vector2d& b = mesh.Cell0DCoordinates[vertices[j]];
+
+            if((a(1) > point(1)) != (b(1) > point(1)) &&
+               point(0) < a(0) + (point(1) - a(1))*(b(0) - a(0))/(b(1) - a(1)))
+                inside = !inside;
+        }
+
+        return inside;
+    }
+// ***************************************************************************
+    unsigned int LocatePoint(const PolygonalMesh& mesh, const SpatialIndex& index, const Vector2d& point)
+    {
+        if(index.NumX == 0)
+            return NotFound;
+
+        const unsigned int bucket = index.BucketY(point(1))*index.NumX + index.BucketX(point(0));
+
+        for(const unsigned int* c = index.BucketCells.Begin(bucket); c != index.BucketCells.End(bucket); c++)
+        {
+            if(point(0) < index.CellMinX[*c] || point(0) > index.CellMaxX[*c] ||
+               point(1) < index.CellMinY[*c] || point(1) > index.CellMaxY[*c])
+                continue;
+
+            if(IsInsideCell(mesh, *c, point))
+                return *c;
+        }
+
+        return NotFound;
+    }
+// ***************************************************************************
+    unsigned int NearestVertex(const PolygonalMesh& mesh, const SpatialIndex& index, const Vector2d& point)
+    {
+        if(mesh.NumberCell0D == 0 || index.NumX == 0)
+            return NotFound;
+
+        const int bx = index.BucketX(point(0)), by = index.BucketY(point(1));
+        const int numX = index.NumX, numY = index.NumY;
+        unsigned int nearest = NotFound;
+        double nearestDistance = numeric_limits<double>::max();
+
+        auto visit = [&](const int& i, const int& j)
+        {
+            if(i < 0 || j < 0 || i >= numX || j >= numY)
+                return;
+
+            const unsigned int bucket = j*index.NumX + i;
+
+            for(const unsigned int* v = index.BucketVertices.Begin(bucket); v != index.BucketVertices.End(bucket); v++)
+            {
+                const double distance = (mesh.Cell0DCoordinates[*v] - point).norm();
+
+                if(distance < nearestDistance || (distance == nearestDistance && *v < nearest)){
+                    nearest = *v;
+                    nearestDistance = distance;
+                }
+            }
+        };
+
+        for(int r = 0; ; r++)
+        {
+            // the buckets of the ring r around (bx, by)
+            for(int i = bx - r; i <= bx + r; i++)
+            {
+                visit(i, by - r);
+
+                if(r > 0)
+                    visit(i, by + r);
+            }
+
+            for(int j = by - r + 1; j < by + r; j++)
+            {
+                visit(bx - r, j);
+                visit(bx + r, j);
+            }
+
+            const bool left = bx - r > 0, right = bx + r < numX - 1, bottom = by - r > 0, top = by + r < numY - 1;
+
+            if(!left && !right && !bottom && !top)
+                break;
+
+            // the vertices outside the buckets searched so far are farther than the closest side with buckets beyond it
+            double bound = numeric_limits<double>::max();
+
+            if(left)
+                bound = min(bound, max(0.0, point(0) - (index.LowerX + (bx - r)*index.BucketSizeX)));
+            if(right)
+                bound = min(bound, max(0.0, index.LowerX + (bx + r + 1)*index.BucketSizeX - point(0)));
+            if(bottom)
+                bound = min(bound, max(0.0, point(1) - (index.LowerY + (by - r)*index.BucketSizeY)));
+            if(top)
+                bound = min(bound, max(0.0, index.LowerY + (by + r + 1)*index.BucketSizeY - point(1)));
+
+            if(nearestDistance < bound)
+                break;
+        }
+
+        return nearest;
+    }
+// ***************************************************************************
+    vector<unsigned int> VerticesInBox(const PolygonalMesh& mesh, const SpatialIndex& index, const Vector2d& lower, const Vector2d& upper)
+    {
+        vector<unsigned int> vertices;
+
+        if(index.NumX == 0 || lower(0) > upper(0) || lower(1) > upper(1))
+            return vertices;
+
+        for(unsigned int j = index.BucketY(lower(1)); j <= index.BucketY(upper(1)); j++)
+        {
+            for(unsigned int i = index.BucketX(lower(0)); i <= index.BucketX(upper(0)); i++)
+            {
+                const unsigned int bucket = j*index.NumX + i;
+
+                for(const unsigned int* v = index.BucketVertices.Begin(bucket); v != index.BucketVertices.End(bucket); v++)
+                {
+                    const Vector2d& coordinates = mesh.Cell0DCoordinates[*v];
+
+                    if(coordinates(0) >= lower(0) && coordinates(0) <= upper(0) && coordinates(1) >= lower(1) && coordinates(1) <= upper(1))
+                        vertices.push_back(*v);
+                }
+            }
+        }
+
+        sort(vertices.begin(), vertices.end());
+
+        return vertices;
+    }
+// ***************************************************************************
+    vector<unsigned int> CellsInBox(const SpatialIndex& index, const Vector2d& lower, const Vector2d& upper)
+    {
+        vector<unsigned int> cells;
+
+        if(index.NumX == 0 || lower(0) > upper(0) || lower(1) > upper(1))
+            return cells;
+
+        for(unsigned int j = index.BucketY(lower(1)); j <= index.BucketY(upper(1)); j++)
+        {
+            for(unsigned int i = index.BucketX(lower(0)); i <= index.BucketX(upper(0)); i++)
+            {
+                const unsigned int bucket = j*index.NumX + i;
+
+                for(const unsigned int* c = index.BucketCells.Begin(bucket); c != index.BucketCells.End(bucket); c++)
+                    if(index.CellMinX[*c] <= upper(0) && index.CellMaxX[*c] >= lower(0) &&
+                       index.CellMinY[*c] <= upper(1) && index.CellMaxY[*c] >= lower(1))
+                        cells.push_back(*c);
+            }
+        }
+
+        // a cell overlapping several buckets is found in each of them
+        sort(cells.begin(), cells.end());
+        cells.erase(unique(cells.begin(), cells.end()), cells.end());
+
+        return cells;
+    }
+// ***************************************************************************
+    void LocatePoints(const PolygonalMesh& mesh,
+                      const SpatialIndex& index,
+                      const vector<Vector2d>& points,
+                      vector<unsigned int>& cells,
+                      const unsigned int& numThreads)
+    {
+        cells.resize(points.size());
+
+        ParallelRanges(points.size(), NumRanges(points.size(), numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int p = first; p < last; p++)
+                cells[p] = LocatePoint(mesh, index, points[p]);
+        });
+    }
+// ***************************************************************************
+    void NearestVertices(const PolygonalMesh& mesh,
+                         const SpatialIndex& index,
+                         const vector<Vector2d>& points,
+                         vector<unsigned int>& vertices,
+                         const unsigned int& numThreads)
+    {
+        vertices.resize(points.size());
+
+        ParallelRanges(points.size(), NumRanges(points.size(), numThreads), numThreads,
+                       [&](const unsigned int& first, const unsigned int& last, const unsigned int&)
+        {
+            for(unsigned int p = first; p < last; p++)
+                vertices[p] = NearestVertex(mesh, index, points[p]);
+        });
+    }
+
+}
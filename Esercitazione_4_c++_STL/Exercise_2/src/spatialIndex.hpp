@@ -0,0 +1,87 @@
+#ifndef __SPATIALINDEX_H
+#define __SPATIALINDEX_H
+
+#include <limits>
+#include <vector>
+#include "polygonalMesh.hpp"
+
+namespace PolygonalLibrary {
+
+  /// \brief The result of the queries which find no cell or no vertex
+  const unsigned int NotFound = std::numeric_limits<unsigned int>::max();
+
+  /// \brief A uniform grid of buckets over the bounding box of a mesh: each bucket lists the Cell0Ds inside it
+  /// and the Cell2Ds whose bounding box overlaps it. The bucket (i, j) is the number j*NumX + i
+  struct SpatialIndex
+  {
+    double LowerX = 0.0, LowerY = 0.0; ///< the lower left corner of the grid
+    double BucketSizeX = 1.0, BucketSizeY = 1.0;
+    unsigned int NumX = 0, NumY = 0;
+
+    CsrArray BucketVertices;
+    CsrArray BucketCells;
+
+    /// the bounding boxes of the Cell2Ds
+    std::vector<double> CellMinX, CellMinY, CellMaxX, CellMaxY;
+
+    /// \brief the column of the buckets containing x, clamped to the grid
+    unsigned int BucketX(const double& x) const
+    {
+      const double i = (x - LowerX)/BucketSizeX;
+
+      return i <= 0.0 ? 0 : i >= NumX - 1 ? NumX - 1 : static_cast<unsigned int>(i);
+    }
+
+    /// \brief the row of the buckets containing y, clamped to the grid
+    unsigned int BucketY(const double& y) const
+    {
+      const double j = (y - LowerY)/BucketSizeY;
+
+      return j <= 0.0 ? 0 : j >= NumY - 1 ? NumY - 1 : static_cast<unsigned int>(j);
+    }
+  };
+
+  ///\brief Build the spatial index of a mesh, the buckets are filled with parallel counting sorts
+  ///\param mesh: a PolygonalMesh struct, whose ids are its positions
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  ///\param cellsPerBucket: the average number of Cell2Ds of a bucket, which sets the size of the grid
+  SpatialIndex BuildSpatialIndex(const PolygonalMesh& mesh, const unsigned int& numThreads = 1, const double& cellsPerBucket = 2.0);
+
+  ///\brief Check if the point is inside the Cell2D c (crossing number test, the cell can be non convex)
+  bool IsInsideCell(const PolygonalMesh& mesh, const unsigned int& c, const Vector2d& point);
+
+  ///\brief Find the Cell2D containing the point
+  ///\return the Cell2D, one of the cells sharing the edge for a point on an edge, NotFound for a point outside the mesh
+  unsigned int LocatePoint(const PolygonalMesh& mesh, const SpatialIndex& index, const Vector2d& point);
+
+  ///\brief Find the Cell0D closest to the point, searching the buckets in rings of growing size around the point
+  ///\return the Cell0D, NotFound for a mesh without vertices
+  unsigned int NearestVertex(const PolygonalMesh& mesh, const SpatialIndex& index, const Vector2d& point);
+
+  ///\brief Find the Cell0Ds inside the box [lower, upper], sorted by id
+  std::vector<unsigned int> VerticesInBox(const PolygonalMesh& mesh, const SpatialIndex& index, const Vector2d& lower, const Vector2d& upper);
+
+  ///\brief Find the Cell2Ds whose bounding box overlaps the box [lower, upper], sorted by id
+  std::vector<unsigned int> CellsInBox(const SpatialIndex& index, const Vector2d& lower, const Vector2d& upper);
+
+  ///\brief LocatePoint on a batch of points, in parallel
+  ///\param cells: the Cell2D containing each point
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  void LocatePoints(const PolygonalMesh& mesh,
+                    const SpatialIndex& index,
+                    const std::vector<Vector2d>& points,
+                    std::vector<unsigned int>& cells,
+                    const unsigned int& numThreads = 1);
+
+  ///\brief NearestVertex on a batch of points, in parallel
+  ///\param vertices: the Cell0D closest to each point
+  ///\param numThreads: the number of threads, 0 means all the hardware threads
+  void NearestVertices(const PolygonalMesh& mesh,
+                       const SpatialIndex& index,
+                       const std::vector<Vector2d>& points,
+                       std::vector<unsigned int>& vertices,
+                       const unsigned int& numThreads = 1);
+
+}
+
+#endif // __SPATIALINDEX_H
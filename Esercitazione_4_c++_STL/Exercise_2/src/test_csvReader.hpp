@@ -0,0 +1,74 @@
+#ifndef __TEST_CSVREADER_H
+#define __TEST_CSVREADER_H
+
+#include <gtest/gtest.h>
+#include "csvReader.hpp"
+
+using namespace testing;
+using namespace PolygonalLibrary;
+
+TEST(TestCsvReader, TestCountLines)
+{
+  const string text = "Id;Marker\n0;1\n1;0";
+  const char* first = text.c_str();
+  const char* last = first + text.size();
+
+  EXPECT_EQ(CountLines(first, last), 3u);
+  EXPECT_EQ(CountLines(first, last - 3), 2u);
+  EXPECT_EQ(CountLines(first, first), 0u);
+  EXPECT_EQ(NextLine(first, last), first + 10);
+  EXPECT_EQ(NextLine(last - 3, last), last);
+}
+
+TEST(TestCsvReader, TestParseFields)
+{
+  const string text = "13;0;2.5000000000000000e-01;3.75e-01\r\n7;x";
+  const char* it = text.c_str();
+  const char* last = it + text.size();
+  unsigned int id, marker;
+  double x, y;
+
+  ASSERT_TRUE(ParseUnsigned(it, last, id));
+  ASSERT_TRUE(ParseUnsigned(it, last, marker));
+  ASSERT_TRUE(ParseDouble(it, last, x));
+  ASSERT_TRUE(ParseDouble(it, last, y));
+  EXPECT_EQ(id, 13u);
+  EXPECT_EQ(marker, 0u);
+  EXPECT_DOUBLE_EQ(x, 0.25);
+  EXPECT_DOUBLE_EQ(y, 0.375);
+
+  // a missing field does not read the next line
+  EXPECT_FALSE(ParseUnsigned(it, last, id));
+
+  it = NextLine(it, last);
+  ASSERT_TRUE(ParseUnsigned(it, last, id));
+  EXPECT_EQ(id, 7u);
+  EXPECT_FALSE(ParseUnsigned(it, last, id));
+  EXPECT_FALSE(ParseDouble(it, last, x));
+}
+
+TEST(TestCsvReader, TestSplitLines)
+{
+  const string text = "0;1\n\n22;3\n4;55\n6";
+  const char* first = text.c_str();
+  const char* last = first + text.size();
+
+  const vector<const char*> bounds = SplitLines(first, last, 4);
+
+  ASSERT_EQ(bounds.size(), 5u);
+  EXPECT_EQ(bounds.front(), first);
+  EXPECT_EQ(bounds.back(), last);
+
+  unsigned int numRows = 0;
+
+  for(unsigned int r = 0; r < 4; r++)
+  {
+    ASSERT_LE(bounds[r], bounds[r + 1]);
+    EXPECT_TRUE(bounds[r] == first || *(bounds[r] - 1) == '\n');
+    numRows += CountRows(bounds[r], bounds[r + 1]);
+  }
+
+  EXPECT_EQ(numRows, 4u);
+}
+
+#endif // __TEST_CSVREADER_H
@@ -0,0 +1,97 @@
+#ifndef __TEST_MESHCACHE_H
+#define __TEST_MESHCACHE_H
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <utime.h>
+#include "meshCache.hpp"
+#include "meshImport.hpp"
+
+using namespace testing;
+using namespace PolygonalLibrary;
+
+TEST(TestMeshCache, TestExportImport)
+{
+  PolygonalMesh mesh, cached;
+  const string filePath = "./TestMesh.cache";
+
+  ASSERT_TRUE(ImportCell0Ds(mesh) && ImportCell1Ds(mesh) && ImportCell2Ds(mesh));
+  ASSERT_TRUE(ExportMeshCache(mesh, filePath));
+  ASSERT_TRUE(ImportMeshCache(cached, filePath));
+
+  EXPECT_EQ(cached.NumberCell0D, mesh.NumberCell0D);
+  EXPECT_EQ(cached.NumberCell1D, mesh.NumberCell1D);
+  EXPECT_EQ(cached.NumberCell2D, mesh.NumberCell2D);
+  EXPECT_EQ(cached.Cell0DId, mesh.Cell0DId);
+  EXPECT_EQ(cached.Cell0DCoordinates, mesh.Cell0DCoordinates);
+  EXPECT_EQ(cached.Cell0DMarkers.Keys, mesh.Cell0DMarkers.Keys);
+  EXPECT_EQ(cached.Cell0DMarkers.Ids.Offsets, mesh.Cell0DMarkers.Ids.Offsets);
+  EXPECT_EQ(cached.Cell1DVertices, mesh.Cell1DVertices);
+  EXPECT_EQ(cached.Cell1DMarkers.Ids.Indices, mesh.Cell1DMarkers.Ids.Indices);
+  EXPECT_EQ(cached.Cell2DMarker, mesh.Cell2DMarker);
+  EXPECT_EQ(cached.Cell2DVertices.Offsets, mesh.Cell2DVertices.Offsets);
+  EXPECT_EQ(cached.Cell2DEdges.Indices, mesh.Cell2DEdges.Indices);
+
+  // a truncated file is refused and leaves the mesh untouched
+  ifstream file(filePath, ios::binary);
+  const string content((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+  file.close();
+
+  ofstream truncated(filePath, ios::binary);
+  truncated.write(content.data(), content.size() - 5);
+  truncated.close();
+
+  EXPECT_FALSE(ImportMeshCache(cached, filePath));
+  EXPECT_EQ(cached.NumberCell2D, mesh.NumberCell2D);
+
+  remove(filePath.c_str());
+  EXPECT_FALSE(ImportMeshCache(cached, filePath));
+}
+
+TEST(TestMeshCache, TestCacheUpToDate)
+{
+  const string sourcePath = "./TestSource.csv";
+  const string cachePath = "./TestSource.cache";
+
+  ofstream(sourcePath) << "Id\n";
+  ofstream(cachePath) << "cache";
+
+  // same second: the source may have been modified after the cache
+  EXPECT_FALSE(IsCacheUpToDate(cachePath, {sourcePath}));
+
+  utimbuf later;
+  later.actime = later.modtime = time(nullptr) + 10;
+  utime(cachePath.c_str(), &later);
+
+  EXPECT_TRUE(IsCacheUpToDate(cachePath, {sourcePath}));
+  EXPECT_FALSE(IsCacheUpToDate("./Missing.cache", {sourcePath}));
+
+  remove(sourcePath.c_str());
+  remove(cachePath.c_str());
+}
+
+TEST(TestMeshCache, TestImportMeshCache)
+{
+  PolygonalMesh mesh;
+  const string cachePath = string("./") + MeshCacheFileName;
+
+  // the first import parses the files and writes the cache, make it newer than the files
+  remove(cachePath.c_str());
+  ASSERT_TRUE(ImportMesh(mesh));
+
+  utimbuf later;
+  later.actime = later.modtime = time(nullptr) + 10;
+  ASSERT_EQ(utime(cachePath.c_str(), &later), 0);
+
+  PolygonalMesh cached;
+
+  ASSERT_TRUE(ImportMesh(cached));
+  EXPECT_EQ(cached.NumberCell2D, mesh.NumberCell2D);
+  EXPECT_EQ(cached.Cell2DVertices.Indices, mesh.Cell2DVertices.Indices);
+
+  remove(cachePath.c_str());
+}
+
+#endif // __TEST_MESHCACHE_H
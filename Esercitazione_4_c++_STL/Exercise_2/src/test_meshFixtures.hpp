@@ -0,0 +1,38 @@
+#ifndef __TEST_MESHFIXTURES_H
+#define __TEST_MESHFIXTURES_H
+
+#include "meshGenerators.hpp"
+#include "polygonalMesh.hpp"
+
+using namespace PolygonalLibrary;
+
+/// \brief The unit square split in two triangles by the diagonal 0-2
+inline PolygonalMesh SquareMesh()
+{
+  PolygonalMesh mesh;
+
+  mesh.NumberCell0D = 4;
+  mesh.Cell0DId = {0, 1, 2, 3};
+  mesh.Cell0DCoordinates = {Vector2d(0, 0), Vector2d(1, 0), Vector2d(1, 1), Vector2d(0, 1)};
+
+  mesh.NumberCell1D = 5;
+  mesh.Cell1DId = {0, 1, 2, 3, 4};
+  mesh.Cell1DVertices = {Vector2i(0, 1), Vector2i(1, 2), Vector2i(2, 3), Vector2i(3, 0), Vector2i(0, 2)};
+
+  const vector<unsigned int> vertices[2] = {{0, 1, 2}, {0, 2, 3}};
+  const vector<unsigned int> edges[2] = {{0, 1, 4}, {4, 2, 3}};
+
+  mesh.NumberCell2D = 2;
+  mesh.Cell2DId = {0, 1};
+  mesh.Cell2DMarker = {0, 0};
+
+  for(unsigned int c = 0; c < 2; c++)
+  {
+    mesh.Cell2DVertices.PushBack(vertices[c].begin(), vertices[c].end());
+    mesh.Cell2DEdges.PushBack(edges[c].begin(), edges[c].end());
+  }
+
+  return mesh;
+}
+
+#endif // __TEST_MESHFIXTURES_H
@@ -0,0 +1,100 @@
+#ifndef __TEST_MESHGEOMETRY_H
+#define __TEST_MESHGEOMETRY_H
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <numeric>
+#include "meshGeometry.hpp"
+#include "meshImport.hpp"
+#include "meshPartition.hpp"
+#include "test_meshFixtures.hpp"
+
+using namespace testing;
+using namespace PolygonalLibrary;
+
+TEST(TestMeshGeometry, TestSquareMesh)
+{
+  MeshGeometry geometry;
+
+  ComputeGeometry(SquareMesh(), geometry);
+
+  ASSERT_EQ(geometry.CellAreas.size(), 2u);
+  EXPECT_DOUBLE_EQ(geometry.CellAreas[0], 0.5);
+  EXPECT_DOUBLE_EQ(geometry.CellAreas[1], 0.5);
+  EXPECT_DOUBLE_EQ(geometry.CellCentroidsX[0], 2.0/3.0);
+  EXPECT_DOUBLE_EQ(geometry.CellCentroidsY[0], 1.0/3.0);
+  EXPECT_DOUBLE_EQ(geometry.CellCentroidsX[1], 1.0/3.0);
+  EXPECT_DOUBLE_EQ(geometry.CellCentroidsY[1], 2.0/3.0);
+
+  ASSERT_EQ(geometry.EdgeLengths.size(), 5u);
+  EXPECT_DOUBLE_EQ(geometry.EdgeLengths[0], 1.0);
+  EXPECT_DOUBLE_EQ(geometry.EdgeLengths[4], sqrt(2.0));
+}
+
+TEST(TestMeshGeometry, TestGridMesh)
+{
+  const unsigned int n = 150;
+  const PolygonalMesh mesh = GridMesh(n);
+  MeshGeometry sequential, parallel;
+
+  ComputeGeometry(mesh, sequential, 1);
+  ComputeGeometry(mesh, parallel, 4);
+
+  EXPECT_EQ(parallel.CellAreas, sequential.CellAreas);
+  EXPECT_EQ(parallel.CellCentroidsX, sequential.CellCentroidsX);
+  EXPECT_EQ(parallel.EdgeLengths, sequential.EdgeLengths);
+
+  EXPECT_NEAR(accumulate(parallel.CellAreas.begin(), parallel.CellAreas.end(), 0.0), 1.0, 1e-12);
+  EXPECT_NEAR(parallel.CellCentroidsX[n + 2], 2.5/n, 1e-15);
+  EXPECT_NEAR(parallel.CellCentroidsY[n + 2], 1.5/n, 1e-15);
+}
+
+TEST(TestMeshGeometry, TestCachedGeometry)
+{
+  PolygonalMesh mesh;
+
+  ASSERT_TRUE(ImportMesh(mesh, ".", 1, false));
+  EXPECT_FALSE(mesh.GeometryUpToDate);
+
+  const MeshGeometry& geometry = UpdateGeometry(mesh);
+
+  EXPECT_TRUE(mesh.GeometryUpToDate);
+  EXPECT_NEAR(accumulate(geometry.CellAreas.begin(), geometry.CellAreas.end(), 0.0), 1.0, 1e-12);
+
+  // moving a vertex invalidates the areas of the cells around it
+  const double area = geometry.CellAreas[0];
+  const unsigned int vertex = *mesh.Cell2DVertices.Begin(0);
+
+  MoveCell0D(mesh, vertex, mesh.Cell0DCoordinates[vertex] + Vector2d(1e-3, 1e-3));
+  EXPECT_FALSE(mesh.GeometryUpToDate);
+  EXPECT_NE(UpdateGeometry(mesh).CellAreas[0], area);
+
+  MeshGeometry computed;
+  EXPECT_EQ(&CachedGeometry(mesh, computed), &mesh.Geometry);
+
+  InvalidateGeometry(mesh);
+  EXPECT_EQ(&CachedGeometry(mesh, computed), &computed);
+  EXPECT_EQ(computed.CellAreas.size(), mesh.NumberCell2D);
+}
+
+TEST(TestMeshGeometry, TestConsumersUseCache)
+{
+  // the mutable overloads bring the cache up to date
+  PolygonalMesh grid = GridMesh(4);
+  const unsigned int part = PartitionMesh(grid, 2).CellParts[0];
+
+  EXPECT_TRUE(grid.GeometryUpToDate);
+
+  // the const ones read it: mirrored centroids move the first cell to the other half
+  for(double& x : grid.Geometry.CellCentroidsX)
+    x = -x;
+
+  const PolygonalMesh& constGrid = grid;
+  EXPECT_NE(PartitionMesh(constGrid, 2).CellParts[0], part);
+
+  InvalidateGeometry(grid);
+  EXPECT_EQ(PartitionMesh(constGrid, 2).CellParts[0], part);
+  EXPECT_FALSE(grid.GeometryUpToDate);
+}
+
+#endif // __TEST_MESHGEOMETRY_H
@@ -0,0 +1,120 @@
+#ifndef __TEST_MESHIMPORT_H
+#define __TEST_MESHIMPORT_H
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include "meshImport.hpp"
+
+using namespace testing;
+using namespace PolygonalLibrary;
+
+TEST(TestMeshImport, TestCsrArray)
+{
+  CsrArray array;
+  const vector<unsigned int> first = {3, 1, 4};
+  const vector<unsigned int> second = {1, 5};
+
+  array.PushBack(first.begin(), first.end());
+  array.PushBack(second.begin(), second.end());
+
+  ASSERT_EQ(array.Size(), 2u);
+  EXPECT_EQ(array.Size(0), 3u);
+  EXPECT_EQ(array.Size(1), 2u);
+  EXPECT_EQ(vector<unsigned int>(array.Begin(1), array.End(1)), second);
+  EXPECT_EQ(array.Indices.size(), 5u);
+}
+
+TEST(TestMeshImport, TestImportCell2Ds)
+{
+  PolygonalMesh mesh;
+
+  ASSERT_TRUE(ImportCell2Ds(mesh));
+  ASSERT_EQ(mesh.NumberCell2D, 81u);
+  ASSERT_EQ(mesh.Cell2DVertices.Size(), 81u);
+  ASSERT_EQ(mesh.Cell2DEdges.Size(), 81u);
+
+  // 0;0;3;16;1;9;3;8;9;10
+  EXPECT_EQ(vector<unsigned int>(mesh.Cell2DVertices.Begin(0), mesh.Cell2DVertices.End(0)), vector<unsigned int>({16, 1, 9}));
+  EXPECT_EQ(vector<unsigned int>(mesh.Cell2DEdges.Begin(0), mesh.Cell2DEdges.End(0)), vector<unsigned int>({8, 9, 10}));
+}
+
+TEST(TestMeshImport, TestImportCell0Ds)
+{
+  PolygonalMesh mesh;
+
+  ASSERT_TRUE(ImportCell0Ds(mesh, "./Cell0Ds.csv"));
+  ASSERT_EQ(mesh.NumberCell0D, 103u);
+  ASSERT_EQ(mesh.Cell0DCoordinates.size(), 103u);
+
+  // 13;0;2.5000000000000000e-01;3.7500000000000000e-01
+  EXPECT_EQ(mesh.Cell0DId[13], 13u);
+  EXPECT_DOUBLE_EQ(mesh.Cell0DCoordinates[13](0), 0.25);
+  EXPECT_DOUBLE_EQ(mesh.Cell0DCoordinates[13](1), 0.375);
+
+  EXPECT_FALSE(ImportCell0Ds(mesh, "./Missing.csv"));
+}
+
+TEST(TestMeshImport, TestImportCell2DsParallel)
+{
+  // a file of a few MB, so that it is split in several byte ranges
+  const string filePath = "./TestCell2Ds.csv";
+  ofstream file(filePath);
+  file << "Id;Marker;NumVertices;Vertices;NumEdges;Edges\n";
+
+  for(unsigned int c = 0; c < 200000; c++)
+  {
+    const unsigned int numVertices = 3 + c % 3;
+    file << c << ";" << c % 5 << ";" << numVertices;
+
+    for(unsigned int v = 0; v < numVertices; v++)
+      file << ";" << c + v;
+
+    file << ";" << numVertices;
+
+    for(unsigned int e = 0; e < numVertices; e++)
+      file << ";" << 2*c + e;
+
+    file << "\n";
+  }
+
+  file.close();
+
+  PolygonalMesh sequential, parallel;
+
+  ASSERT_TRUE(ImportCell2Ds(sequential, filePath, 1));
+  ASSERT_TRUE(ImportCell2Ds(parallel, filePath, 4));
+  remove(filePath.c_str());
+
+  ASSERT_EQ(parallel.NumberCell2D, 200000u);
+  EXPECT_EQ(parallel.Cell2DId, sequential.Cell2DId);
+  EXPECT_EQ(parallel.Cell2DMarker, sequential.Cell2DMarker);
+  EXPECT_EQ(parallel.Cell2DVertices.Offsets, sequential.Cell2DVertices.Offsets);
+  EXPECT_EQ(parallel.Cell2DVertices.Indices, sequential.Cell2DVertices.Indices);
+  EXPECT_EQ(parallel.Cell2DEdges.Offsets, sequential.Cell2DEdges.Offsets);
+  EXPECT_EQ(parallel.Cell2DEdges.Indices, sequential.Cell2DEdges.Indices);
+
+  const unsigned int c = 123457;
+  EXPECT_EQ(parallel.Cell2DId[c], c);
+  EXPECT_EQ(vector<unsigned int>(parallel.Cell2DVertices.Begin(c), parallel.Cell2DVertices.End(c)), vector<unsigned int>({c, c + 1, c + 2, c + 3}));
+}
+
+TEST(TestMeshImport, TestImportMesh)
+{
+  PolygonalMesh mesh;
+
+  ASSERT_TRUE(ImportMesh(mesh));
+  EXPECT_EQ(mesh.NumberCell0D, 103u);
+  EXPECT_EQ(mesh.NumberCell1D, 183u);
+  EXPECT_EQ(mesh.NumberCell2D, 81u);
+
+  PolygonalMesh concurrent;
+
+  ASSERT_TRUE(ImportMesh(concurrent, ".", 3, false));
+  EXPECT_EQ(concurrent.Cell1DId, mesh.Cell1DId);
+  EXPECT_EQ(concurrent.Cell2DVertices.Indices, mesh.Cell2DVertices.Indices);
+  EXPECT_EQ(concurrent.Cell0DMarkers.Keys, mesh.Cell0DMarkers.Keys);
+  EXPECT_EQ(concurrent.Cell0DMarkers.Ids.Indices, mesh.Cell0DMarkers.Ids.Indices);
+}
+
+#endif // __TEST_MESHIMPORT_H
@@ -0,0 +1,66 @@
+#ifndef __TEST_MESHMARKERS_H
+#define __TEST_MESHMARKERS_H
+
+#include <gtest/gtest.h>
+#include "meshImport.hpp"
+#include "meshMarkers.hpp"
+
+using namespace testing;
+using namespace PolygonalLibrary;
+
+TEST(TestMeshMarkers, TestBuildMarkerTable)
+{
+  const vector<unsigned int> markers = {2, 0, 7, 2, 0, 7, 7};
+  const vector<unsigned int> ids = {10, 11, 12, 13, 14, 15, 16};
+  MarkerTable table;
+
+  BuildMarkerTable(markers, ids, table);
+
+  ASSERT_EQ(table.Size(), 2u);
+  EXPECT_EQ(table.Keys, vector<unsigned int>({2, 7}));
+  EXPECT_EQ(table.Ids.Offsets, vector<unsigned int>({0, 2, 5}));
+  EXPECT_EQ(table.Ids.Indices, vector<unsigned int>({10, 13, 12, 15, 16}));
+
+  EXPECT_EQ(table.Find(7), 1u);
+  EXPECT_EQ(table.Find(0), table.Size());
+  EXPECT_EQ(table.Find(3), table.Size());
+  EXPECT_EQ(vector<unsigned int>(table.Begin(1), table.End(1)), vector<unsigned int>({12, 15, 16}));
+}
+
+TEST(TestMeshMarkers, TestSparseMarkers)
+{
+  // markers much larger than the number of cells are grouped by sorting
+  const vector<unsigned int> markers = {4000000000u, 5, 0, 4000000000u};
+  const vector<unsigned int> ids = {0, 1, 2, 3};
+  MarkerTable table;
+
+  BuildMarkerTable(markers, ids, table);
+
+  EXPECT_EQ(table.Keys, vector<unsigned int>({5, 4000000000u}));
+  EXPECT_EQ(table.Ids.Offsets, vector<unsigned int>({0, 1, 3}));
+  EXPECT_EQ(table.Ids.Indices, vector<unsigned int>({1, 0, 3}));
+
+  BuildMarkerTable(vector<unsigned int>(3, 0), ids, table);
+
+  EXPECT_EQ(table.Size(), 0u);
+  EXPECT_EQ(table.Ids.Offsets, vector<unsigned int>({0}));
+}
+
+TEST(TestMeshMarkers, TestImportMarkers)
+{
+  PolygonalMesh mesh;
+
+  ASSERT_TRUE(ImportCell0Ds(mesh));
+
+  // the corners of the square have the markers 1 to 4, one vertex each
+  for(unsigned int marker = 1; marker <= 4; marker++)
+  {
+    const unsigned int k = mesh.Cell0DMarkers.Find(marker);
+
+    ASSERT_NE(k, mesh.Cell0DMarkers.Size());
+    EXPECT_EQ(mesh.Cell0DMarkers.Ids.Size(k), 1u);
+    EXPECT_EQ(*mesh.Cell0DMarkers.Begin(k), marker - 1);
+  }
+}
+
+#endif // __TEST_MESHMARKERS_H
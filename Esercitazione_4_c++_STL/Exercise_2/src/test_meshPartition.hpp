@@ -0,0 +1,150 @@
+#ifndef __TEST_MESHPARTITION_H
+#define __TEST_MESHPARTITION_H
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <set>
+#include "meshImport.hpp"
+#include "meshPartition.hpp"
+#include "test_meshFixtures.hpp"
+
+using namespace testing;
+using namespace PolygonalLibrary;
+
+/// \brief The Cell2Ds of mesh sharing a vertex with the Cell2D c, c excluded
+inline set<unsigned int> VertexNeighbours(const PolygonalMesh& mesh, const unsigned int& c)
+{
+  set<unsigned int> neighbours;
+
+  for(unsigned int d = 0; d < mesh.NumberCell2D; d++)
+    for(const unsigned int* v = mesh.Cell2DVertices.Begin(d); v != mesh.Cell2DVertices.End(d); v++)
+      if(d != c && find(mesh.Cell2DVertices.Begin(c), mesh.Cell2DVertices.End(c), *v) != mesh.Cell2DVertices.End(c))
+        neighbours.insert(d);
+
+  return neighbours;
+}
+
+TEST(TestMeshPartition, TestPartitionMesh)
+{
+  const unsigned int n = 20;
+  const PolygonalMesh mesh = GridMesh(n);
+
+  // four quadrants of the square
+  const MeshPartition quadrants = PartitionMesh(mesh, 4, 2);
+
+  ASSERT_EQ(quadrants.NumParts(), 4u);
+
+  for(unsigned int p = 0; p < 4; p++)
+  {
+    EXPECT_EQ(quadrants.InteriorCells.Size(p) + quadrants.InterfaceCells.Size(p), n*n/4);
+    EXPECT_EQ(quadrants.InterfaceCells.Size(p), n - 1);
+    EXPECT_EQ(quadrants.HaloCells.Size(p), n + 1);
+  }
+
+  EXPECT_EQ(quadrants.CellParts[0], quadrants.CellParts[n/2 - 1]);
+  EXPECT_NE(quadrants.CellParts[0], quadrants.CellParts[n/2]);
+  EXPECT_NE(quadrants.CellParts[0], quadrants.CellParts[n*n/2]);
+
+  const MeshPartition empty = PartitionMesh(mesh, 0, 2);
+  EXPECT_EQ(empty.NumParts(), 0u);
+  EXPECT_TRUE(empty.CellParts.empty());
+
+  for(const unsigned int numParts : {1u, 3u, 7u, 16u})
+  {
+    const MeshPartition partition = PartitionMesh(mesh, numParts, 3);
+
+    ASSERT_EQ(partition.NumParts(), numParts);
+    ASSERT_EQ(partition.HaloCells.Size(), numParts);
+
+    for(unsigned int p = 0; p < numParts; p++)
+    {
+      const unsigned int size = partition.InteriorCells.Size(p) + partition.InterfaceCells.Size(p);
+      EXPECT_LE(size, n*n/numParts + 2);
+      EXPECT_GE(size + 2, n*n/numParts);
+
+      EXPECT_TRUE(is_sorted(partition.InteriorCells.Begin(p), partition.InteriorCells.End(p)));
+      EXPECT_TRUE(is_sorted(partition.InterfaceCells.Begin(p), partition.InterfaceCells.End(p)));
+
+      // the interior cells touch only their part, the halo is everything the interface cells touch outside
+      set<unsigned int> halo;
+
+      for(const unsigned int* c = partition.InteriorCells.Begin(p); c != partition.InteriorCells.End(p); c++)
+      {
+        ASSERT_EQ(partition.CellParts[*c], p);
+
+        for(const unsigned int& d : VertexNeighbours(mesh, *c))
+          ASSERT_EQ(partition.CellParts[d], p);
+      }
+
+      for(const unsigned int* c = partition.InterfaceCells.Begin(p); c != partition.InterfaceCells.End(p); c++)
+      {
+        ASSERT_EQ(partition.CellParts[*c], p);
+
+        for(const unsigned int& d : VertexNeighbours(mesh, *c))
+          if(partition.CellParts[d] != p)
+            halo.insert(d);
+      }
+
+      EXPECT_EQ(vector<unsigned int>(halo.begin(), halo.end()),
+                vector<unsigned int>(partition.HaloCells.Begin(p), partition.HaloCells.End(p)));
+    }
+  }
+}
+
+TEST(TestMeshPartition, TestColourMesh)
+{
+  PolygonalMesh mesh;
+
+  ASSERT_TRUE(ImportCell0Ds(mesh) && ImportCell1Ds(mesh) && ImportCell2Ds(mesh));
+
+  for(const PolygonalMesh& coloured : {mesh, GridMesh(10)})
+  {
+    const MeshColouring colouring = ColourMesh(coloured, 2);
+
+    ASSERT_EQ(colouring.ColourCells.Indices.size(), coloured.NumberCell2D);
+
+    for(unsigned int c = 0; c < coloured.NumberCell2D; c++)
+      for(const unsigned int& d : VertexNeighbours(coloured, c))
+        ASSERT_NE(colouring.CellColours[c], colouring.CellColours[d]);
+
+    for(unsigned int k = 0; k < colouring.NumColours(); k++)
+    {
+      ASSERT_GT(colouring.ColourCells.Size(k), 0u);
+
+      for(const unsigned int* c = colouring.ColourCells.Begin(k); c != colouring.ColourCells.End(k); c++)
+        ASSERT_EQ(colouring.CellColours[*c], k);
+    }
+  }
+
+  // the squares of a grid need four colours
+  EXPECT_EQ(ColourMesh(GridMesh(10)).NumColours(), 4u);
+}
+
+TEST(TestMeshPartition, TestCellLoops)
+{
+  const PolygonalMesh mesh = GridMesh(50);
+
+  // scatter-add of each cell to its vertices: conflicting writes would lose updates
+  vector<unsigned int> expected(mesh.NumberCell0D, 0);
+
+  for(const unsigned int& v : mesh.Cell2DVertices.Indices)
+    expected[v]++;
+
+  auto scatter = [&mesh](vector<unsigned int>& counts)
+  {
+    return [&mesh, &counts](const unsigned int& c)
+    {
+      for(const unsigned int* v = mesh.Cell2DVertices.Begin(c); v != mesh.Cell2DVertices.End(c); v++)
+        counts[*v]++;
+    };
+  };
+
+  vector<unsigned int> partitioned(mesh.NumberCell0D, 0), coloured(mesh.NumberCell0D, 0);
+  PartitionedCellLoop(PartitionMesh(mesh, 4, 4), 4, scatter(partitioned));
+  ColouredCellLoop(ColourMesh(mesh, 4), 4, scatter(coloured));
+
+  EXPECT_EQ(partitioned, expected);
+  EXPECT_EQ(coloured, expected);
+}
+
+#endif // __TEST_MESHPARTITION_H
@@ -0,0 +1,113 @@
+#ifndef __TEST_MESHQUALITY_H
+#define __TEST_MESHQUALITY_H
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include "meshImport.hpp"
+#include "meshQuality.hpp"
+#include "test_meshFixtures.hpp"
+
+using namespace testing;
+using namespace PolygonalLibrary;
+
+TEST(TestMeshQuality, TestGoodMeshes)
+{
+  EXPECT_TRUE(CheckQuality(SquareMesh()).empty());
+  EXPECT_TRUE(CheckQuality(GridMesh(150), 1.0e-10, 4).empty());
+
+  PolygonalMesh mesh;
+
+  ASSERT_TRUE(ImportCell0Ds(mesh) && ImportCell1Ds(mesh) && ImportCell2Ds(mesh));
+  EXPECT_TRUE(CheckQuality(mesh).empty());
+}
+
+TEST(TestMeshQuality, TestEdgesAndVertices)
+{
+  PolygonalMesh mesh = SquareMesh();
+
+  // the cell 1 turns clockwise: its area is negative and the diagonal is run twice from 0 to 2
+  mesh.Cell2DVertices.Begin(1)[1] = 3;
+  mesh.Cell2DVertices.Begin(1)[2] = 2;
+
+  // the edge 5 is in no cell, the edge 6 repeats the diagonal
+  mesh.Cell1DVertices.push_back(Vector2i(1, 3));
+  mesh.Cell1DVertices.push_back(Vector2i(2, 0));
+  mesh.Cell1DId = {0, 1, 2, 3, 4, 5, 6};
+  mesh.NumberCell1D = 7;
+
+  // the vertex 4 is on the vertex 2
+  mesh.Cell0DCoordinates.push_back(Vector2d(1.0, 1.0 + 1.0e-12));
+  mesh.Cell0DId.push_back(4);
+  mesh.NumberCell0D = 5;
+
+  const vector<QualityIssue> issues = CheckQuality(mesh, 1.0e-10, 2);
+
+  ASSERT_EQ(issues.size(), 6u);
+
+  EXPECT_EQ(issues[0].Type, QualityIssueType::NegativeAreaCell);
+  EXPECT_EQ(issues[0].Id, 1u);
+  EXPECT_DOUBLE_EQ(issues[0].Value, -0.5);
+
+  EXPECT_EQ(issues[1].Type, QualityIssueType::DuplicateEdge);
+  EXPECT_EQ(issues[1].Id, 6u);
+  EXPECT_EQ(issues[1].Other, 4u);
+
+  EXPECT_EQ(issues[2].Type, QualityIssueType::DanglingEdge);
+  EXPECT_EQ(issues[2].Id, 5u);
+  EXPECT_EQ(issues[3].Type, QualityIssueType::DanglingEdge);
+  EXPECT_EQ(issues[3].Id, 6u);
+
+  EXPECT_EQ(issues[4].Type, QualityIssueType::DuplicateVertex);
+  EXPECT_EQ(issues[4].Id, 4u);
+  EXPECT_EQ(issues[4].Other, 2u);
+  EXPECT_NEAR(issues[4].Value, 1.0e-12, 1.0e-15);
+
+  EXPECT_EQ(issues[5].Type, QualityIssueType::InconsistentOrientation);
+  EXPECT_EQ(issues[5].Id, 4u);
+  EXPECT_EQ(issues[5].Other, 1u);
+}
+
+TEST(TestMeshQuality, TestCells)
+{
+  PolygonalMesh mesh;
+
+  mesh.Cell0DCoordinates = {Vector2d(0, 0), Vector2d(2, 0), Vector2d(1, 0.5), Vector2d(0, 2), Vector2d(1, 0)};
+  mesh.Cell0DId = {0, 1, 2, 3, 4};
+  mesh.NumberCell0D = 5;
+  mesh.NumberCell1D = 0;
+
+  // an arrow with a reflex vertex 2 and a flat triangle
+  const vector<unsigned int> arrow = {0, 1, 2, 3}, flat = {0, 4, 1};
+  mesh.Cell2DVertices.PushBack(arrow.begin(), arrow.end());
+  mesh.Cell2DVertices.PushBack(flat.begin(), flat.end());
+  mesh.Cell2DEdges.PushBack(arrow.end(), arrow.end());
+  mesh.Cell2DEdges.PushBack(flat.end(), flat.end());
+  mesh.Cell2DId = {0, 1};
+  mesh.Cell2DMarker = {0, 0};
+  mesh.NumberCell2D = 2;
+
+  const vector<QualityIssue> issues = CheckQuality(mesh);
+
+  ASSERT_EQ(issues.size(), 2u);
+  EXPECT_EQ(issues[0].Type, QualityIssueType::ZeroAreaCell);
+  EXPECT_EQ(issues[0].Id, 1u);
+  EXPECT_EQ(issues[1].Type, QualityIssueType::NonConvexCell);
+  EXPECT_EQ(issues[1].Id, 0u);
+  EXPECT_EQ(issues[1].Other, 2u);
+
+  const string filePath = "./TestQuality.csv";
+  ASSERT_TRUE(ExportQualityReport(issues, filePath));
+
+  ifstream file(filePath);
+  string header, line;
+  getline(file, header);
+  getline(file, line);
+  file.close();
+  remove(filePath.c_str());
+
+  EXPECT_EQ(header, "Type;Id;Other;Value");
+  EXPECT_EQ(line, "ZeroAreaCell;1;0;0.0000000000000000e+00");
+}
+
+#endif // __TEST_MESHQUALITY_H
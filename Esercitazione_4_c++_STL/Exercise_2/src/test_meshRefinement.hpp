@@ -0,0 +1,172 @@
+#ifndef __TEST_MESHREFINEMENT_H
+#define __TEST_MESHREFINEMENT_H
+
+#include <gtest/gtest.h>
+#include "meshGeometry.hpp"
+#include "meshImport.hpp"
+#include "meshQuality.hpp"
+#include "meshRefinement.hpp"
+#include "meshValidation.hpp"
+#include "test_meshFixtures.hpp"
+
+using namespace testing;
+using namespace PolygonalLibrary;
+
+/// \brief Check that the refined mesh is valid, of good quality and with the same area of mesh
+inline void ExpectGoodRefinement(const PolygonalMesh& mesh, PolygonalMesh& refined)
+{
+  EXPECT_TRUE(ValidateMesh(refined).empty());
+  EXPECT_TRUE(CheckQuality(refined).empty());
+
+  for(unsigned int c = 0; c < refined.NumberCell2D; c++)
+    ASSERT_EQ(refined.Cell2DId[c], c);
+
+  MeshGeometry geometry;
+  ComputeGeometry(mesh, geometry);
+  const MeshGeometry& refinedGeometry = UpdateGeometry(refined, 2);
+
+  double area = 0.0, refinedArea = 0.0;
+
+  for(const double& cellArea : geometry.CellAreas)
+    area += cellArea;
+
+  for(const double& cellArea : refinedGeometry.CellAreas)
+  {
+    ASSERT_GT(cellArea, 0.0);
+    refinedArea += cellArea;
+  }
+
+  EXPECT_NEAR(refinedArea, area, 1.0e-12*area);
+}
+
+TEST(TestMeshRefinement, TestUniformRefinement)
+{
+  const PolygonalMesh square = SquareMesh();
+  PolygonalMesh refinedSquare = RefineMesh(square);
+
+  EXPECT_EQ(refinedSquare.NumberCell0D, 9u);
+  EXPECT_EQ(refinedSquare.NumberCell1D, 16u);
+  EXPECT_EQ(refinedSquare.NumberCell2D, 8u);
+  ExpectGoodRefinement(square, refinedSquare);
+
+  // the diagonal keeps its id and its first half, the corner 0 of the first triangle keeps the id of the triangle
+  EXPECT_EQ(refinedSquare.Cell1DVertices[4], Vector2i(0, 4 + 4));
+  EXPECT_EQ(refinedSquare.Cell0DCoordinates[8], Vector2d(0.5, 0.5));
+  EXPECT_EQ(vector<unsigned int>(refinedSquare.Cell2DVertices.Begin(0), refinedSquare.Cell2DVertices.End(0)),
+            vector<unsigned int>({0, 4, 8}));
+
+  // the squares of a grid become the squares of the grid twice as fine
+  const unsigned int n = 4;
+  const PolygonalMesh grid = GridMesh(n);
+  PolygonalMesh refinedGrid = RefineMesh(grid, 3);
+
+  EXPECT_EQ(refinedGrid.NumberCell0D, (2*n + 1)*(2*n + 1));
+  EXPECT_EQ(refinedGrid.NumberCell1D, 2*(2*n)*(2*n + 1));
+  EXPECT_EQ(refinedGrid.NumberCell2D, 4*n*n);
+  ExpectGoodRefinement(grid, refinedGrid);
+
+  for(const double& cellArea : refinedGrid.Geometry.CellAreas)
+    ASSERT_NEAR(cellArea, 0.25/(n*n), 1.0e-15);
+
+  // the boundary markers pass to the halves and to the midpoints of the boundary edges
+  ASSERT_EQ(refinedGrid.Cell0DMarkers.Keys, vector<unsigned int>({1}));
+  ASSERT_EQ(refinedGrid.Cell1DMarkers.Keys, vector<unsigned int>({1}));
+  EXPECT_EQ(refinedGrid.Cell0DMarkers.Ids.Size(0), 8*n);
+  EXPECT_EQ(refinedGrid.Cell1DMarkers.Ids.Size(0), 8*n);
+
+  for(const unsigned int& v : refinedGrid.Cell0DMarkers.Ids.Indices)
+  {
+    const Vector2d& point = refinedGrid.Cell0DCoordinates[v];
+    ASSERT_TRUE(point.minCoeff() == 0.0 || point.maxCoeff() == 1.0);
+  }
+}
+
+TEST(TestMeshRefinement, TestInvalidMesh)
+{
+  // three vertices and two edges: the refinement would read the edges of the next cell
+  PolygonalMesh square = SquareMesh();
+  const unsigned int edges[2][3] = {{0, 1}, {4, 2, 3}};
+  square.Cell2DEdges = CsrArray();
+  square.Cell2DEdges.PushBack(edges[0], edges[0] + 2);
+  square.Cell2DEdges.PushBack(edges[1], edges[1] + 3);
+
+  EXPECT_EQ(RefineMesh(square).NumberCell2D, 0u);
+  EXPECT_EQ(RefineMesh(SquareMesh(), vector<bool>(1, true)).NumberCell2D, 0u);
+}
+
+TEST(TestMeshRefinement, TestImportedMesh)
+{
+  PolygonalMesh mesh;
+
+  ASSERT_TRUE(ImportCell0Ds(mesh) && ImportCell1Ds(mesh) && ImportCell2Ds(mesh));
+
+  PolygonalMesh refined = RefineMesh(mesh, 2);
+
+  // a triangle gives four children and three internal edges, a polygon of n vertices a centre, n children and n internal edges
+  unsigned int numCentres = 0, numInternalEdges = 0, numChildren = 0;
+
+  for(unsigned int c = 0; c < mesh.NumberCell2D; c++)
+  {
+    const unsigned int n = mesh.Cell2DVertices.Size(c);
+
+    numCentres += n == 3 ? 0 : 1;
+    numInternalEdges += n;
+    numChildren += n == 3 ? 4 : n;
+  }
+
+  EXPECT_EQ(refined.NumberCell0D, mesh.NumberCell0D + mesh.NumberCell1D + numCentres);
+  EXPECT_EQ(refined.NumberCell1D, 2*mesh.NumberCell1D + numInternalEdges);
+  EXPECT_EQ(refined.NumberCell2D, numChildren);
+  ExpectGoodRefinement(mesh, refined);
+
+  // each edge marker doubles, each vertex marker gains the edges with the same marker
+  EXPECT_EQ(refined.Cell1DMarkers.Keys, mesh.Cell1DMarkers.Keys);
+
+  for(unsigned int k = 0; k < mesh.Cell1DMarkers.Size(); k++)
+  {
+    const unsigned int marker = mesh.Cell1DMarkers.Keys[k];
+    const unsigned int numEdges = mesh.Cell1DMarkers.Ids.Size(k);
+    const unsigned int numVertices = mesh.Cell0DMarkers.Find(marker) < mesh.Cell0DMarkers.Size() ?
+                                     mesh.Cell0DMarkers.Ids.Size(mesh.Cell0DMarkers.Find(marker)) : 0;
+
+    EXPECT_EQ(refined.Cell1DMarkers.Ids.Size(k), 2*numEdges);
+    EXPECT_EQ(refined.Cell0DMarkers.Ids.Size(refined.Cell0DMarkers.Find(marker)), numVertices + numEdges);
+  }
+}
+
+TEST(TestMeshRefinement, TestMarkedRefinement)
+{
+  // the square (0, 0) of a 2 x 2 grid: its neighbours gain a hanging node
+  PolygonalMesh grid = GridMesh(2);
+  grid.Cell2DMarker[0] = 3;
+
+  PolygonalMesh refined = RefineMarkedCells(grid, 3);
+
+  EXPECT_EQ(refined.NumberCell0D, 9u + 5u);
+  EXPECT_EQ(refined.NumberCell1D, 12u + 4u + 4u);
+  EXPECT_EQ(refined.NumberCell2D, 4u + 3u);
+  ExpectGoodRefinement(grid, refined);
+
+  for(unsigned int c = 0; c < refined.NumberCell2D; c++)
+  {
+    const unsigned int size = refined.Cell2DVertices.Size(c);
+
+    EXPECT_EQ(refined.Cell2DMarker[c], c == 0 || c >= 4 ? 3u : 0u);
+    EXPECT_EQ(size, c == 1 || c == 2 ? 5u : 4u);
+  }
+
+  // the square (1, 0) runs the edge 7 between the squares (0, 0) and (1, 0) downwards: first the upper half,
+  // the fourth split edge appended as 12 + 3, then the lower half, which keeps the id 7
+  const vector<unsigned int> edges(refined.Cell2DEdges.Begin(1), refined.Cell2DEdges.End(1));
+  EXPECT_EQ(edges, vector<unsigned int>({1, 8, 3, 12 + 3, 7}));
+
+  // a pentagon with a hanging node is refined in five quadrilaterals
+  vector<bool> refineCells(refined.NumberCell2D, false);
+  refineCells[1] = true;
+  PolygonalMesh twice = RefineMesh(refined, refineCells);
+
+  EXPECT_EQ(twice.NumberCell2D, refined.NumberCell2D + 4);
+  ExpectGoodRefinement(refined, twice);
+}
+
+#endif // __TEST_MESHREFINEMENT_H
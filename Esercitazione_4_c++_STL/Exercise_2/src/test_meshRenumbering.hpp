@@ -0,0 +1,212 @@
+#ifndef __TEST_MESHRENUMBERING_H
+#define __TEST_MESHRENUMBERING_H
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include "meshGeometry.hpp"
+#include "meshRenumbering.hpp"
+#include "meshTopology.hpp"
+#include "meshValidation.hpp"
+#include "test_meshFixtures.hpp"
+
+using namespace testing;
+using namespace PolygonalLibrary;
+
+/// \brief A random permutation of the positions 0, ..., size - 1
+inline vector<unsigned int> RandomPermutation(const unsigned int& size, const unsigned int& seed)
+{
+  vector<unsigned int> permutation(size);
+  iota(permutation.begin(), permutation.end(), 0);
+  shuffle(permutation.begin(), permutation.end(), mt19937(seed));
+
+  return permutation;
+}
+
+/// \brief The largest and the mean distance between the positions of two neighbouring cells
+inline pair<unsigned int, double> CellDistances(const PolygonalMesh& mesh)
+{
+  const MeshTopology topology = BuildTopology(mesh);
+  unsigned int bandwidth = 0;
+  double sum = 0.0;
+
+  for(unsigned int c = 0; c < mesh.NumberCell2D; c++)
+  {
+    for(const unsigned int* n = topology.CellNeighbours.Begin(c); n != topology.CellNeighbours.End(c); n++)
+    {
+      bandwidth = max(bandwidth, c > *n ? c - *n : *n - c);
+      sum += c > *n ? c - *n : *n - c;
+    }
+  }
+
+  return {bandwidth, sum/topology.CellNeighbours.Indices.size()};
+}
+
+TEST(TestMeshRenumbering, TestCurveKeys)
+{
+  EXPECT_EQ(MortonKey(0, 0), 0u);
+  EXPECT_EQ(MortonKey(1, 0), 1u);
+  EXPECT_EQ(MortonKey(0, 1), 2u);
+  EXPECT_EQ(MortonKey(3, 3), 15u);
+  EXPECT_EQ(MortonKey(65535, 65535), 0xFFFFFFFFull);
+
+  // the Hilbert curve visits each point once, moving between neighbours
+  const unsigned int side = 1 << 16;
+  vector<pair<unsigned long long, unsigned int>> points;
+
+  for(unsigned int y = 0; y < 16; y++)
+    for(unsigned int x = 0; x < 16; x++)
+      points.push_back({HilbertKey(x, y), y*16 + x});
+
+  sort(points.begin(), points.end());
+
+  EXPECT_EQ(points.front().first, 0u);
+  EXPECT_EQ(points.back().first, 255u);
+
+  for(unsigned int k = 1; k < points.size(); k++)
+  {
+    const int dx = int(points[k].second % 16) - int(points[k - 1].second % 16);
+    const int dy = int(points[k].second / 16) - int(points[k - 1].second / 16);
+    ASSERT_EQ(points[k].first, points[k - 1].first + 1);
+    ASSERT_EQ(abs(dx) + abs(dy), 1);
+  }
+
+  EXPECT_EQ(HilbertKey(side - 1, 0), static_cast<unsigned long long>(side)*side - 1);
+}
+
+TEST(TestMeshRenumbering, TestRenumberMesh)
+{
+  const unsigned int n = 30;
+  const PolygonalMesh grid = GridMesh(n);
+  PolygonalMesh mesh = grid;
+
+  // a scrambled grid: the same cells in random order
+  MeshPermutation scramble;
+  scramble.Cell0Ds = RandomPermutation(grid.NumberCell0D, 1);
+  scramble.Cell1Ds = RandomPermutation(grid.NumberCell1D, 2);
+  scramble.Cell2Ds = RandomPermutation(grid.NumberCell2D, 3);
+  RenumberMesh(mesh, scramble, 2);
+
+  EXPECT_TRUE(ValidateMesh(mesh).empty());
+  EXPECT_GT(CellDistances(mesh).second, 5.0*n);
+
+  for(unsigned int c = 0; c < grid.NumberCell2D; c++)
+  {
+    const unsigned int newCell = scramble.Cell2Ds[c];
+    ASSERT_EQ(mesh.Cell2DVertices.Size(newCell), 4u);
+
+    for(unsigned int i = 0; i < 4; i++)
+    {
+      ASSERT_EQ(mesh.Cell2DVertices.Begin(newCell)[i], scramble.Cell0Ds[grid.Cell2DVertices.Begin(c)[i]]);
+      ASSERT_EQ(mesh.Cell2DEdges.Begin(newCell)[i], scramble.Cell1Ds[grid.Cell2DEdges.Begin(c)[i]]);
+    }
+  }
+
+  for(const RenumberingMethod method : {RenumberingMethod::ReverseCuthillMcKee, RenumberingMethod::Morton, RenumberingMethod::Hilbert})
+  {
+    PolygonalMesh renumbered = mesh;
+    const MeshPermutation permutation = ComputeRenumbering(renumbered, method, 2);
+
+    for(const vector<unsigned int>* positions : {&permutation.Cell0Ds, &permutation.Cell1Ds, &permutation.Cell2Ds})
+    {
+      vector<unsigned int> sorted = *positions;
+      sort(sorted.begin(), sorted.end());
+
+      for(unsigned int k = 0; k < sorted.size(); k++)
+        ASSERT_EQ(sorted[k], k);
+    }
+
+    RenumberMesh(renumbered, permutation, 2);
+
+    EXPECT_TRUE(ValidateMesh(renumbered).empty());
+    EXPECT_FALSE(renumbered.GeometryUpToDate);
+
+    for(unsigned int v = 0; v < renumbered.NumberCell0D; v++)
+      ASSERT_EQ(renumbered.Cell0DId[v], v);
+
+    // the same cells, closer in memory
+    UpdateGeometry(renumbered);
+    double area = 0.0;
+
+    for(const double& cellArea : renumbered.Geometry.CellAreas)
+    {
+      ASSERT_NEAR(cellArea, 1.0/(n*n), 1.0e-14);
+      area += cellArea;
+    }
+
+    EXPECT_NEAR(area, 1.0, 1.0e-12);
+
+    // the space filling curves jump at the quadrant sides, but most neighbours stay close
+    const pair<unsigned int, double> distances = CellDistances(renumbered);
+    EXPECT_LE(distances.second, double(n));
+
+    if(method == RenumberingMethod::ReverseCuthillMcKee)
+    {
+      EXPECT_LE(distances.first, 2*n);
+    }
+
+    // the boundary keeps its markers
+    const unsigned int k = renumbered.Cell0DMarkers.Find(1);
+    ASSERT_LT(k, renumbered.Cell0DMarkers.Size());
+    EXPECT_EQ(renumbered.Cell0DMarkers.Ids.Size(k), 4*n);
+    EXPECT_TRUE(is_sorted(renumbered.Cell0DMarkers.Begin(k), renumbered.Cell0DMarkers.End(k)));
+
+    for(const unsigned int* v = renumbered.Cell0DMarkers.Begin(k); v != renumbered.Cell0DMarkers.End(k); v++)
+    {
+      const Vector2d& point = renumbered.Cell0DCoordinates[*v];
+      ASSERT_TRUE(point.minCoeff() < 1.0e-14 || point.maxCoeff() > 1.0 - 1.0e-14);
+    }
+
+    const unsigned int h = renumbered.Cell1DMarkers.Find(1);
+    ASSERT_LT(h, renumbered.Cell1DMarkers.Size());
+    EXPECT_EQ(renumbered.Cell1DMarkers.Ids.Size(h), 4*n);
+
+    for(const unsigned int* e = renumbered.Cell1DMarkers.Begin(h); e != renumbered.Cell1DMarkers.End(h); e++)
+    {
+      const Vector2d middle = 0.5*(renumbered.Cell0DCoordinates[renumbered.Cell1DVertices[*e][0]] +
+                                   renumbered.Cell0DCoordinates[renumbered.Cell1DVertices[*e][1]]);
+      ASSERT_TRUE(middle.minCoeff() < 1.0e-14 || middle.maxCoeff() > 1.0 - 1.0e-14);
+    }
+  }
+}
+
+TEST(TestMeshRenumbering, TestDisconnectedCells)
+{
+  // two separate squares and an unused vertex
+  PolygonalMesh mesh = SquareMesh();
+  mesh.NumberCell0D = 9;
+  mesh.Cell0DId = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+  mesh.Cell0DCoordinates.push_back(Vector2d(5, 5));
+  mesh.Cell0DCoordinates.push_back(Vector2d(3, 0));
+  mesh.Cell0DCoordinates.push_back(Vector2d(4, 0));
+  mesh.Cell0DCoordinates.push_back(Vector2d(4, 1));
+  mesh.Cell0DCoordinates.push_back(Vector2d(3, 1));
+
+  mesh.NumberCell1D = 9;
+  mesh.Cell1DId = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+  mesh.Cell1DVertices.insert(mesh.Cell1DVertices.end(), {Vector2i(5, 6), Vector2i(6, 7), Vector2i(7, 8), Vector2i(8, 5)});
+
+  const unsigned int vertices[4] = {5, 6, 7, 8}, edges[4] = {5, 6, 7, 8};
+  mesh.NumberCell2D = 3;
+  mesh.Cell2DId = {0, 1, 2};
+  mesh.Cell2DMarker = {0, 0, 7};
+  mesh.Cell2DVertices.PushBack(vertices, vertices + 4);
+  mesh.Cell2DEdges.PushBack(edges, edges + 4);
+
+  for(const RenumberingMethod method : {RenumberingMethod::ReverseCuthillMcKee, RenumberingMethod::Hilbert})
+  {
+    PolygonalMesh renumbered = mesh;
+    const MeshPermutation permutation = ComputeRenumbering(renumbered, method);
+    RenumberMesh(renumbered, permutation);
+
+    EXPECT_TRUE(ValidateMesh(renumbered).empty());
+    EXPECT_EQ(renumbered.Cell2DMarker[permutation.Cell2Ds[2]], 7u);
+
+    // the unused vertex goes last
+    EXPECT_EQ(permutation.Cell0Ds[4], 8u);
+    EXPECT_EQ(renumbered.Cell0DCoordinates[8], Vector2d(5, 5));
+  }
+}
+
+#endif // __TEST_MESHRENUMBERING_H
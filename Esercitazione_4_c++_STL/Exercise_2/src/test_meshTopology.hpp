@@ -0,0 +1,94 @@
+#ifndef __TEST_MESHTOPOLOGY_H
+#define __TEST_MESHTOPOLOGY_H
+
+#include <gtest/gtest.h>
+#include "meshImport.hpp"
+#include "meshTopology.hpp"
+#include "meshValidation.hpp"
+#include "test_meshFixtures.hpp"
+
+using namespace testing;
+using namespace PolygonalLibrary;
+
+TEST(TestMeshTopology, TestTransposeCsr)
+{
+  CsrArray array, transposed;
+  const vector<unsigned int> lists[3] = {{2, 0}, {}, {0, 1, 2}};
+
+  for(const vector<unsigned int>& list : lists)
+    array.PushBack(list.begin(), list.end());
+
+  TransposeCsr(array, 4, 2, transposed);
+
+  EXPECT_EQ(transposed.Offsets, vector<unsigned int>({0, 2, 3, 5, 5}));
+  EXPECT_EQ(transposed.Indices, vector<unsigned int>({0, 2, 2, 0, 2}));
+}
+
+TEST(TestMeshTopology, TestSquareMesh)
+{
+  const MeshTopology topology = BuildTopology(SquareMesh());
+
+  // the diagonal 0-2 is shared, the sides are on the boundary
+  EXPECT_EQ(topology.EdgeCells.Offsets, vector<unsigned int>({0, 1, 2, 3, 4, 6}));
+  EXPECT_EQ(topology.EdgeCells.Indices, vector<unsigned int>({0, 0, 1, 1, 0, 1}));
+
+  EXPECT_EQ(vector<unsigned int>(topology.VertexCells.Begin(0), topology.VertexCells.End(0)), vector<unsigned int>({0, 1}));
+  EXPECT_EQ(vector<unsigned int>(topology.VertexCells.Begin(1), topology.VertexCells.End(1)), vector<unsigned int>({0}));
+  EXPECT_EQ(vector<unsigned int>(topology.VertexEdges.Begin(0), topology.VertexEdges.End(0)), vector<unsigned int>({0, 3, 4}));
+
+  EXPECT_EQ(topology.CellNeighbours.Offsets, vector<unsigned int>({0, 1, 2}));
+  EXPECT_EQ(topology.CellNeighbours.Indices, vector<unsigned int>({1, 0}));
+}
+
+TEST(TestMeshTopology, TestGridMesh)
+{
+  // large enough to be split in several ranges
+  const unsigned int n = 150;
+  const PolygonalMesh mesh = GridMesh(n);
+
+  ASSERT_TRUE(ValidateMesh(mesh).empty());
+
+  const MeshTopology sequential = BuildTopology(mesh, 1);
+  const MeshTopology parallel = BuildTopology(mesh, 4);
+
+  EXPECT_EQ(parallel.VertexEdges.Indices, sequential.VertexEdges.Indices);
+  EXPECT_EQ(parallel.VertexCells.Offsets, sequential.VertexCells.Offsets);
+  EXPECT_EQ(parallel.VertexCells.Indices, sequential.VertexCells.Indices);
+  EXPECT_EQ(parallel.EdgeCells.Indices, sequential.EdgeCells.Indices);
+  EXPECT_EQ(parallel.CellNeighbours.Offsets, sequential.CellNeighbours.Offsets);
+  EXPECT_EQ(parallel.CellNeighbours.Indices, sequential.CellNeighbours.Indices);
+
+  // an internal square has the neighbours below, right, above and left
+  const unsigned int c = 7*n + 5;
+  EXPECT_EQ(vector<unsigned int>(parallel.CellNeighbours.Begin(c), parallel.CellNeighbours.End(c)),
+            vector<unsigned int>({c - n, c + 1, c + n, c - 1}));
+  EXPECT_EQ(parallel.VertexCells.Size(8*(n + 1) + 8), 4u);
+  EXPECT_EQ(parallel.VertexEdges.Size(0), 2u);
+}
+
+TEST(TestMeshTopology, TestImportedMesh)
+{
+  PolygonalMesh mesh;
+
+  ASSERT_TRUE(ImportCell0Ds(mesh) && ImportCell1Ds(mesh) && ImportCell2Ds(mesh));
+
+  const MeshTopology sequential = BuildTopology(mesh, 1);
+  const MeshTopology parallel = BuildTopology(mesh, 4);
+
+  EXPECT_EQ(parallel.VertexCells.Indices, sequential.VertexCells.Indices);
+  EXPECT_EQ(parallel.EdgeCells.Indices, sequential.EdgeCells.Indices);
+  EXPECT_EQ(parallel.CellNeighbours.Indices, sequential.CellNeighbours.Indices);
+
+  // every edge has one or two cells and the neighbour relation is symmetric
+  for(unsigned int e = 0; e < mesh.NumberCell1D; e++)
+  {
+    EXPECT_GE(sequential.EdgeCells.Size(e), 1u);
+    EXPECT_LE(sequential.EdgeCells.Size(e), 2u);
+  }
+
+  for(unsigned int c = 0; c < mesh.NumberCell2D; c++)
+    for(const unsigned int* n = sequential.CellNeighbours.Begin(c); n != sequential.CellNeighbours.End(c); n++)
+      EXPECT_NE(find(sequential.CellNeighbours.Begin(*n), sequential.CellNeighbours.End(*n), c), sequential.CellNeighbours.End(*n));
+}
+
+#endif // __TEST_MESHTOPOLOGY_H
@@ -0,0 +1,75 @@
+#ifndef __TEST_MESHVALIDATION_H
+#define __TEST_MESHVALIDATION_H
+
+#include <gtest/gtest.h>
+#include "meshImport.hpp"
+#include "meshValidation.hpp"
+#include "test_meshFixtures.hpp"
+
+using namespace testing;
+using namespace PolygonalLibrary;
+
+TEST(TestMeshValidation, TestValidMesh)
+{
+  EXPECT_TRUE(ValidateMesh(SquareMesh()).empty());
+
+  PolygonalMesh mesh;
+
+  ASSERT_TRUE(ImportCell0Ds(mesh) && ImportCell1Ds(mesh) && ImportCell2Ds(mesh));
+  EXPECT_TRUE(ValidateMesh(mesh, 1).empty());
+  EXPECT_TRUE(ValidateMesh(mesh, 4).empty());
+}
+
+TEST(TestMeshValidation, TestAllDefects)
+{
+  PolygonalMesh mesh = SquareMesh();
+
+  mesh.Cell1DVertices[2] << 2, 7;    // the vertex 7 does not exist
+  mesh.Cell2DEdges.Begin(0)[1] = 3;  // the edge 3-0 does not end in the cell 0
+  mesh.Cell2DEdges.Begin(1)[0] = 9;  // the edge 9 does not exist
+
+  const vector<MeshDefect> defects = ValidateMesh(mesh, 2);
+
+  ASSERT_EQ(defects.size(), 3u);
+
+  EXPECT_EQ(defects[0].Type, MeshDefectType::EdgeVertexOutOfRange);
+  EXPECT_EQ(defects[0].Cell, 2u);
+  EXPECT_EQ(defects[0].Index, 7u);
+
+  EXPECT_EQ(defects[1].Type, MeshDefectType::EdgeOriginNotInCell);
+  EXPECT_EQ(defects[1].Cell, 0u);
+  EXPECT_EQ(defects[1].Index, 3u);
+
+  EXPECT_EQ(defects[2].Type, MeshDefectType::CellEdgeOutOfRange);
+  EXPECT_EQ(defects[2].Cell, 1u);
+  EXPECT_EQ(defects[2].Index, 9u);
+}
+
+TEST(TestMeshValidation, TestEdgeOrder)
+{
+  PolygonalMesh mesh = SquareMesh();
+
+  // the cell 0 lists two edges for three vertices, the cell 1 lists its edges out of order
+  const unsigned int edges[2][3] = {{0, 1}, {2, 4, 3}};
+  mesh.Cell2DEdges = CsrArray();
+  mesh.Cell2DEdges.PushBack(edges[0], edges[0] + 2);
+  mesh.Cell2DEdges.PushBack(edges[1], edges[1] + 3);
+
+  const vector<MeshDefect> defects = ValidateMesh(mesh, 2);
+
+  ASSERT_EQ(defects.size(), 3u);
+
+  EXPECT_EQ(defects[0].Type, MeshDefectType::CellSizeMismatch);
+  EXPECT_EQ(defects[0].Cell, 0u);
+  EXPECT_EQ(defects[0].Index, 2u);
+
+  EXPECT_EQ(defects[1].Type, MeshDefectType::EdgeNotBetweenVertices);
+  EXPECT_EQ(defects[1].Cell, 1u);
+  EXPECT_EQ(defects[1].Index, 2u);
+
+  EXPECT_EQ(defects[2].Type, MeshDefectType::EdgeNotBetweenVertices);
+  EXPECT_EQ(defects[2].Cell, 1u);
+  EXPECT_EQ(defects[2].Index, 4u);
+}
+
+#endif // __TEST_MESHVALIDATION_H
@@ -0,0 +1,107 @@
+#ifndef __TEST_SPATIALINDEX_H
+#define __TEST_SPATIALINDEX_H
+
+#include <gtest/gtest.h>
+#include <random>
+#include "meshGeometry.hpp"
+#include "meshImport.hpp"
+#include "spatialIndex.hpp"
+#include "test_meshFixtures.hpp"
+
+using namespace testing;
+using namespace PolygonalLibrary;
+
+TEST(TestSpatialIndex, TestLocatePoint)
+{
+  const unsigned int n = 40;
+  const PolygonalMesh mesh = GridMesh(n);
+  const SpatialIndex index = BuildSpatialIndex(mesh, 4);
+
+  EXPECT_EQ(index.BucketCells.Size(), index.NumX*index.NumY);
+  EXPECT_EQ(index.BucketVertices.Indices.size(), mesh.NumberCell0D);
+
+  // the square (i, j) is the cell j*n + i
+  EXPECT_EQ(LocatePoint(mesh, index, Vector2d(2.5/n, 7.5/n)), 7*n + 2);
+  EXPECT_EQ(LocatePoint(mesh, index, Vector2d(0.999, 0.001)), n - 1);
+  EXPECT_EQ(LocatePoint(mesh, index, Vector2d(1.5, 0.5)), NotFound);
+  EXPECT_EQ(LocatePoint(mesh, index, Vector2d(-0.1, -0.1)), NotFound);
+
+  mt19937 generator(7);
+  uniform_real_distribution<double> uniform(0.0, 1.0);
+  vector<Vector2d> points(10000);
+
+  for(Vector2d& point : points)
+    point = Vector2d(uniform(generator), uniform(generator));
+
+  vector<unsigned int> cells;
+  LocatePoints(mesh, index, points, cells, 4);
+
+  for(unsigned int p = 0; p < points.size(); p++)
+  {
+    const unsigned int i = points[p](0)*n, j = points[p](1)*n;
+    ASSERT_EQ(cells[p], j*n + i);
+  }
+}
+
+TEST(TestSpatialIndex, TestNearestVertex)
+{
+  PolygonalMesh mesh;
+
+  ASSERT_TRUE(ImportCell0Ds(mesh) && ImportCell1Ds(mesh) && ImportCell2Ds(mesh));
+
+  const SpatialIndex index = BuildSpatialIndex(mesh, 1, 0.5);
+
+  mt19937 generator(11);
+  uniform_real_distribution<double> uniform(-0.5, 1.5);
+  vector<Vector2d> points(2000);
+
+  for(Vector2d& point : points)
+    point = Vector2d(uniform(generator), uniform(generator));
+
+  vector<unsigned int> vertices;
+  NearestVertices(mesh, index, points, vertices, 2);
+
+  for(unsigned int p = 0; p < points.size(); p++)
+  {
+    double nearestDistance = numeric_limits<double>::max();
+
+    for(unsigned int v = 0; v < mesh.NumberCell0D; v++)
+      nearestDistance = min(nearestDistance, (mesh.Cell0DCoordinates[v] - points[p]).norm());
+
+    ASSERT_NE(vertices[p], NotFound);
+    ASSERT_EQ((mesh.Cell0DCoordinates[vertices[p]] - points[p]).norm(), nearestDistance);
+  }
+
+  // every centroid is inside its cell
+  const MeshGeometry& geometry = UpdateGeometry(mesh);
+
+  for(unsigned int c = 0; c < mesh.NumberCell2D; c++)
+    EXPECT_EQ(LocatePoint(mesh, index, Vector2d(geometry.CellCentroidsX[c], geometry.CellCentroidsY[c])), c);
+}
+
+TEST(TestSpatialIndex, TestBoxQueries)
+{
+  const unsigned int n = 20;
+  const PolygonalMesh mesh = GridMesh(n);
+  const SpatialIndex index = BuildSpatialIndex(mesh);
+
+  const Vector2d lower(0.12, 0.33), upper(0.31, 0.41);
+
+  vector<unsigned int> expectedVertices, expectedCells;
+
+  for(unsigned int v = 0; v < mesh.NumberCell0D; v++)
+    if((mesh.Cell0DCoordinates[v].array() >= lower.array()).all() && (mesh.Cell0DCoordinates[v].array() <= upper.array()).all())
+      expectedVertices.push_back(v);
+
+  // the squares from column 2 to 6 and from row 6 to 8
+  for(unsigned int j = 6; j <= 8; j++)
+    for(unsigned int i = 2; i <= 6; i++)
+      expectedCells.push_back(j*n + i);
+
+  EXPECT_EQ(VerticesInBox(mesh, index, lower, upper), expectedVertices);
+  EXPECT_EQ(expectedVertices.size(), 8u);
+  EXPECT_EQ(CellsInBox(index, lower, upper), expectedCells);
+  EXPECT_TRUE(CellsInBox(index, upper, lower).empty());
+}
+
+#endif // __TEST_SPATIALINDEX_H
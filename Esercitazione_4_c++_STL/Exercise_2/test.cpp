@@ -0,0 +1,20 @@
+#include "test_csvReader.hpp"
+#include "test_meshCache.hpp"
+#include "test_meshGeometry.hpp"
+#include "test_meshImport.hpp"
+#include "test_meshMarkers.hpp"
+#include "test_meshPartition.hpp"
+#include "test_meshQuality.hpp"
+#include "test_meshRefinement.hpp"
+#include "test_meshRenumbering.hpp"
+#include "test_meshTopology.hpp"
+#include "test_meshValidation.hpp"
+#include "test_spatialIndex.hpp"
+
+#include <gtest/gtest.h>
+
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}